@@ -0,0 +1,10 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const char* __buildinfo_build_no = "aecae52-dirty";
+const char* __buildinfo_build_date = "2026-10-17 04:03:27";
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,18 @@
+#ifndef __buildinfo_h__
+#define __buildinfo_h__
+
+#define BUILD_NO __buildinfo_build_no
+#define BUILD_DATE __buildinfo_build_date
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const char* __buildinfo_build_no;
+extern const char* __buildinfo_build_date;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __buildinfo_h__
@@ -0,0 +1,336 @@
+
+#include "mempeek_parser.h"
+#include "mempeek_exceptions.h"
+#include "parser.h"
+
+#include <string>
+
+// the parser reads the tokens through class TokenStream, see tokencache.h
+#define YY_DECL int yylex_scan( YYSTYPE* yylval_param, YYLTYPE* yylloc_param, yyscan_t yyscanner )
+
+#define YY_USER_ACTION yylloc->first_line = yylloc->last_line = yylineno; yylloc->file = yyget_extra( yyscanner );
+
+#define TOKEN( t ) yylval_param->value = yytext; yylval_param->token = t; return t;
+#define STRINGTOKEN( t ) yylval_param->value = parse_escape_characters( yytext ); yylval_param->token = t; return t;
+
+std::string parse_escape_characters( std::string str );
+
+
+#include <regex>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "lexer.h"
+
+struct yy_buffer_state { std::string text; };
+struct yyguts_t { const char* extra = nullptr; YY_BUFFER_STATE buf = nullptr; size_t pos = 0; int lineno = 1; bool bol = true; std::string yytext; };
+
+int yylex_init( yyscan_t* s ) { *s = new yyguts_t; return 0; }
+int yylex_destroy( yyscan_t s ) { delete (yyguts_t*)s; return 0; }
+void yyset_extra( const char* e, yyscan_t s ) { ((yyguts_t*)s)->extra = e; }
+const char* yyget_extra( yyscan_t s ) { return ((yyguts_t*)s)->extra; }
+YY_BUFFER_STATE yy_create_buffer( FILE* f, int, yyscan_t ) {
+    YY_BUFFER_STATE b = new yy_buffer_state; char tmp[4096]; size_t n;
+    while( (n = fread( tmp, 1, sizeof(tmp), f )) > 0 ) b->text.append( tmp, n );
+    return b;
+}
+YY_BUFFER_STATE yy_scan_string( const char* str, yyscan_t s ) { YY_BUFFER_STATE b = new yy_buffer_state; b->text = str; yy_switch_to_buffer( b, s ); return b; }
+YY_BUFFER_STATE yy_scan_bytes( const char* str, int len, yyscan_t s ) { YY_BUFFER_STATE b = new yy_buffer_state; b->text.assign( str, len ); yy_switch_to_buffer( b, s ); return b; }
+void yy_switch_to_buffer( YY_BUFFER_STATE b, yyscan_t s ) { ((yyguts_t*)s)->buf = b; ((yyguts_t*)s)->pos = 0; }
+void yy_delete_buffer( YY_BUFFER_STATE b, yyscan_t ) { delete b; }
+
+struct fake_rule { bool bol; std::regex re; };
+
+static std::vector<fake_rule>& fake_rules() {
+    static std::vector<fake_rule> rules = {
+        { true, std::regex( "[ \\t]*(\\#[^\\n]*)?\\n" ) },
+        { false, std::regex( "\\#[^\\n]*(?=\\n|$)" ) },
+        { false, std::regex( "[ \\t]" ) },
+        { false, std::regex( "\\\\[ \\t]*\\n" ) },
+        { false, std::regex( "\\n" ) },
+        { false, std::regex( "\\;" ) },
+        { false, std::regex( "def" ) },
+        { false, std::regex( "dim" ) },
+        { false, std::regex( "map" ) },
+        { false, std::regex( "at" ) },
+        { false, std::regex( "defproc" ) },
+        { false, std::regex( "endproc" ) },
+        { false, std::regex( "deffunc" ) },
+        { false, std::regex( "endfunc" ) },
+        { false, std::regex( "drop" ) },
+        { false, std::regex( "exit" ) },
+        { false, std::regex( "global" ) },
+        { false, std::regex( "static" ) },
+        { false, std::regex( "from" ) },
+        { false, std::regex( "import" ) },
+        { false, std::regex( "run" ) },
+        { false, std::regex( "peek" ) },
+        { false, std::regex( "poke" ) },
+        { false, std::regex( "peekblock" ) },
+        { false, std::regex( "pokeblock" ) },
+        { false, std::regex( "memfind" ) },
+        { false, std::regex( "mask" ) },
+        { false, std::regex( "if" ) },
+        { false, std::regex( "then" ) },
+        { false, std::regex( "else" ) },
+        { false, std::regex( "endif" ) },
+        { false, std::regex( "while" ) },
+        { false, std::regex( "do" ) },
+        { false, std::regex( "endwhile" ) },
+        { false, std::regex( "for" ) },
+        { false, std::regex( "to" ) },
+        { false, std::regex( "step" ) },
+        { false, std::regex( "endfor" ) },
+        { false, std::regex( "every" ) },
+        { false, std::regex( "catchup" ) },
+        { false, std::regex( "endevery" ) },
+        { false, std::regex( "guard" ) },
+        { false, std::regex( "endguard" ) },
+        { false, std::regex( "print" ) },
+        { false, std::regex( "dec" ) },
+        { false, std::regex( "hex" ) },
+        { false, std::regex( "bin" ) },
+        { false, std::regex( "neg" ) },
+        { false, std::regex( "float" ) },
+        { false, std::regex( "array" ) },
+        { false, std::regex( "string" ) },
+        { false, std::regex( "noendl" ) },
+        { false, std::regex( "sleep" ) },
+        { false, std::regex( "until" ) },
+        { false, std::regex( "now" ) },
+        { false, std::regex( "break" ) },
+        { false, std::regex( "quit" ) },
+        { false, std::regex( "pragma" ) },
+        { false, std::regex( "wordsize" ) },
+        { false, std::regex( "loadpath" ) },
+        { false, std::regex( "memoize" ) },
+        { false, std::regex( "\\.\\.\\." ) },
+        { false, std::regex( "args" ) },
+        { false, std::regex( "\\:8" ) },
+        { false, std::regex( "\\:16" ) },
+        { false, std::regex( "\\:32" ) },
+        { false, std::regex( "\\:64" ) },
+        { false, std::regex( "\\:\\=" ) },
+        { false, std::regex( "\\+" ) },
+        { false, std::regex( "\\-" ) },
+        { false, std::regex( "\\*" ) },
+        { false, std::regex( "\\/" ) },
+        { false, std::regex( "\\%" ) },
+        { false, std::regex( "\\<\\<" ) },
+        { false, std::regex( "\\>\\>" ) },
+        { false, std::regex( "\\-\\/" ) },
+        { false, std::regex( "\\-\\%" ) },
+        { false, std::regex( "\\&" ) },
+        { false, std::regex( "\\|" ) },
+        { false, std::regex( "\\^" ) },
+        { false, std::regex( "\\~" ) },
+        { false, std::regex( "\\&\\&" ) },
+        { false, std::regex( "\\|\\|" ) },
+        { false, std::regex( "\\^\\^" ) },
+        { false, std::regex( "\\!" ) },
+        { false, std::regex( "\\<" ) },
+        { false, std::regex( "\\>" ) },
+        { false, std::regex( "\\<\\=" ) },
+        { false, std::regex( "\\>\\=" ) },
+        { false, std::regex( "\\=\\=" ) },
+        { false, std::regex( "\\!\\=" ) },
+        { false, std::regex( "\\-\\<" ) },
+        { false, std::regex( "\\-\\>" ) },
+        { false, std::regex( "\\-\\<\\=" ) },
+        { false, std::regex( "\\-\\>\\=" ) },
+        { false, std::regex( "\\." ) },
+        { false, std::regex( "\\," ) },
+        { false, std::regex( "\\[" ) },
+        { false, std::regex( "\\]" ) },
+        { false, std::regex( "\\{" ) },
+        { false, std::regex( "\\}" ) },
+        { false, std::regex( "\\(" ) },
+        { false, std::regex( "\\)" ) },
+        { false, std::regex( "\\?" ) },
+        { false, std::regex( "[a-zA-Z][a-zA-Z0-9_]*" ) },
+        { false, std::regex( "0x[0-9a-fA-F_]*[0-9a-fA-F]" ) },
+        { false, std::regex( "0b[01_]*[01]" ) },
+        { false, std::regex( "[0-9]([0-9_]*[0-9])?" ) },
+        { false, std::regex( "[+-]?[0-9]*\\.[0-9]+" ) },
+        { false, std::regex( "[+-]?[0-9]*\\.?[0-9]+[eE][+-]?[0-9]+" ) },
+        { false, std::regex( "\\\"(\\\\[rnt\\\"\\\\]|\\\\x[0-9a-fA-F]{2}|[^\\\\\"])*\\\"" ) },
+        { false, std::regex( "[^\\n]" ) },
+    };
+    return rules;
+}
+
+#ifndef YY_DECL
+#define YY_DECL int yylex( YYSTYPE* yylval_param, YYLTYPE* yylloc_param, yyscan_t yyscanner )
+#endif
+YY_DECL
+{
+    YYLTYPE* yylloc = yylloc_param;
+    yyguts_t* g = (yyguts_t*)yyscanner;
+    int& yylineno = g->lineno;
+    for(;;) {
+        const std::string& in = g->buf->text;
+        if( g->pos >= in.size() ) return 0;
+        size_t best = 0; int rule = -1;
+        auto& rules = fake_rules();
+        for( size_t i = 0; i < rules.size(); i++ ) {
+            if( rules[i].bol && !g->bol ) continue;
+            std::smatch m;
+            if( std::regex_search( in.begin() + g->pos, in.end(), m, rules[i].re, std::regex_constants::match_continuous ) ) {
+                size_t len = m.length(0);
+                if( len > best ) { best = len; rule = i; }
+            }
+        }
+        if( rule < 0 ) { best = 1; rule = rules.size() - 1; }
+        g->yytext = in.substr( g->pos, best );
+        g->pos += best;
+        for( char c: g->yytext ) if( c == '\n' ) yylineno++;
+        g->bol = g->yytext.back() == '\n';
+        const char* yytext = g->yytext.c_str();
+        (void)yytext;
+        switch( rule ) {
+        case 0: { YY_USER_ACTION ; /* ignore empty lines */ } break;
+        case 1: { YY_USER_ACTION ; /* ignore comments */ } break;
+        case 2: { YY_USER_ACTION ; /* skip whitespace */ } break;
+        case 3: { YY_USER_ACTION ; /* wrap lines with backslash */ } break;
+        case 4: { YY_USER_ACTION TOKEN( T_END_OF_STATEMENT ) } break;
+        case 5: { YY_USER_ACTION TOKEN( T_END_OF_STATEMENT ) } break;
+        case 6: { YY_USER_ACTION TOKEN( T_DEF ) } break;
+        case 7: { YY_USER_ACTION TOKEN( T_DIM ) } break;
+        case 8: { YY_USER_ACTION TOKEN( T_MAP ) } break;
+        case 9: { YY_USER_ACTION TOKEN( T_AT ) } break;
+        case 10: { YY_USER_ACTION TOKEN( T_DEFPROC ) } break;
+        case 11: { YY_USER_ACTION TOKEN( T_ENDPROC ) } break;
+        case 12: { YY_USER_ACTION TOKEN( T_DEFFUNC ) } break;
+        case 13: { YY_USER_ACTION TOKEN( T_ENDFUNC ) } break;
+        case 14: { YY_USER_ACTION TOKEN( T_DROP ) } break;
+        case 15: { YY_USER_ACTION TOKEN( T_EXIT ) } break;
+        case 16: { YY_USER_ACTION TOKEN( T_GLOBAL ) } break;
+        case 17: { YY_USER_ACTION TOKEN( T_STATIC ) } break;
+        case 18: { YY_USER_ACTION TOKEN( T_FROM ) } break;
+        case 19: { YY_USER_ACTION TOKEN( T_IMPORT ) } break;
+        case 20: { YY_USER_ACTION TOKEN( T_RUN ) } break;
+        case 21: { YY_USER_ACTION TOKEN( T_PEEK ) } break;
+        case 22: { YY_USER_ACTION TOKEN( T_POKE ) } break;
+        case 23: { YY_USER_ACTION TOKEN( T_PEEKBLOCK ) } break;
+        case 24: { YY_USER_ACTION TOKEN( T_POKEBLOCK ) } break;
+        case 25: { YY_USER_ACTION TOKEN( T_MEMFIND ) } break;
+        case 26: { YY_USER_ACTION TOKEN( T_MASK ) } break;
+        case 27: { YY_USER_ACTION TOKEN( T_IF ) } break;
+        case 28: { YY_USER_ACTION TOKEN( T_THEN ) } break;
+        case 29: { YY_USER_ACTION TOKEN( T_ELSE ) } break;
+        case 30: { YY_USER_ACTION TOKEN( T_ENDIF ) } break;
+        case 31: { YY_USER_ACTION TOKEN( T_WHILE ) } break;
+        case 32: { YY_USER_ACTION TOKEN( T_DO ) } break;
+        case 33: { YY_USER_ACTION TOKEN( T_ENDWHILE ) } break;
+        case 34: { YY_USER_ACTION TOKEN( T_FOR ) } break;
+        case 35: { YY_USER_ACTION TOKEN( T_TO ) } break;
+        case 36: { YY_USER_ACTION TOKEN( T_STEP ) } break;
+        case 37: { YY_USER_ACTION TOKEN( T_ENDFOR ) } break;
+        case 38: { YY_USER_ACTION TOKEN( T_EVERY ) } break;
+        case 39: { YY_USER_ACTION TOKEN( T_CATCHUP ) } break;
+        case 40: { YY_USER_ACTION TOKEN( T_ENDEVERY ) } break;
+        case 41: { YY_USER_ACTION TOKEN( T_GUARD ) } break;
+        case 42: { YY_USER_ACTION TOKEN( T_ENDGUARD ) } break;
+        case 43: { YY_USER_ACTION TOKEN( T_PRINT ) } break;
+        case 44: { YY_USER_ACTION TOKEN( T_DEC ) } break;
+        case 45: { YY_USER_ACTION TOKEN( T_HEX ) } break;
+        case 46: { YY_USER_ACTION TOKEN( T_BIN ) } break;
+        case 47: { YY_USER_ACTION TOKEN( T_NEG ) } break;
+        case 48: { YY_USER_ACTION TOKEN( T_FLOAT ) } break;
+        case 49: { YY_USER_ACTION TOKEN( T_ARRAY ) } break;
+        case 50: { YY_USER_ACTION TOKEN( T_STRING ) } break;
+        case 51: { YY_USER_ACTION TOKEN( T_NOENDL ) } break;
+        case 52: { YY_USER_ACTION TOKEN( T_SLEEP ) } break;
+        case 53: { YY_USER_ACTION TOKEN( T_UNTIL ) } break;
+        case 54: { YY_USER_ACTION TOKEN( T_NOW ) } break;
+        case 55: { YY_USER_ACTION TOKEN( T_BREAK ) } break;
+        case 56: { YY_USER_ACTION TOKEN( T_QUIT ) } break;
+        case 57: { YY_USER_ACTION TOKEN( T_PRAGMA ) } break;
+        case 58: { YY_USER_ACTION TOKEN( T_WORDSIZE ) } break;
+        case 59: { YY_USER_ACTION TOKEN( T_LOADPATH ) } break;
+        case 60: { YY_USER_ACTION TOKEN( T_MEMOIZE ) } break;
+        case 61: { YY_USER_ACTION TOKEN( T_ELLIPSIS ) } break;
+        case 62: { YY_USER_ACTION TOKEN( T_ARGS ) } break;
+        case 63: { YY_USER_ACTION TOKEN( T_8BIT ) } break;
+        case 64: { YY_USER_ACTION TOKEN( T_16BIT ) } break;
+        case 65: { YY_USER_ACTION TOKEN( T_32BIT ) } break;
+        case 66: { YY_USER_ACTION TOKEN( T_64BIT ) } break;
+        case 67: { YY_USER_ACTION TOKEN( T_ASSIGN ); } break;
+        case 68: { YY_USER_ACTION TOKEN( T_PLUS ) } break;
+        case 69: { YY_USER_ACTION TOKEN( T_MINUS ) } break;
+        case 70: { YY_USER_ACTION TOKEN( T_MUL ) } break;
+        case 71: { YY_USER_ACTION TOKEN( T_DIV ) } break;
+        case 72: { YY_USER_ACTION TOKEN( T_MOD ) } break;
+        case 73: { YY_USER_ACTION TOKEN( T_LSHIFT ) } break;
+        case 74: { YY_USER_ACTION TOKEN( T_RSHIFT ) } break;
+        case 75: { YY_USER_ACTION TOKEN( T_SDIV ) } break;
+        case 76: { YY_USER_ACTION TOKEN( T_SMOD ) } break;
+        case 77: { YY_USER_ACTION TOKEN( T_BIT_AND ) } break;
+        case 78: { YY_USER_ACTION TOKEN( T_BIT_OR ) } break;
+        case 79: { YY_USER_ACTION TOKEN( T_BIT_XOR ) } break;
+        case 80: { YY_USER_ACTION TOKEN( T_BIT_NOT ) } break;
+        case 81: { YY_USER_ACTION TOKEN( T_LOG_AND ) } break;
+        case 82: { YY_USER_ACTION TOKEN( T_LOG_OR ) } break;
+        case 83: { YY_USER_ACTION TOKEN( T_LOG_XOR ) } break;
+        case 84: { YY_USER_ACTION TOKEN( T_LOG_NOT ) } break;
+        case 85: { YY_USER_ACTION TOKEN( T_LT ) } break;
+        case 86: { YY_USER_ACTION TOKEN( T_GT ) } break;
+        case 87: { YY_USER_ACTION TOKEN( T_LE ) } break;
+        case 88: { YY_USER_ACTION TOKEN( T_GE ) } break;
+        case 89: { YY_USER_ACTION TOKEN( T_EQ ) } break;
+        case 90: { YY_USER_ACTION TOKEN( T_NE ) } break;
+        case 91: { YY_USER_ACTION TOKEN( T_SLT ) } break;
+        case 92: { YY_USER_ACTION TOKEN( T_SGT ) } break;
+        case 93: { YY_USER_ACTION TOKEN( T_SLE ) } break;
+        case 94: { YY_USER_ACTION TOKEN( T_SGE ) } break;
+        case 95: { YY_USER_ACTION TOKEN( '.' ) } break;
+        case 96: { YY_USER_ACTION TOKEN( ',' ) } break;
+        case 97: { YY_USER_ACTION TOKEN( '[' ) } break;
+        case 98: { YY_USER_ACTION TOKEN( ']' ) } break;
+        case 99: { YY_USER_ACTION TOKEN( '{' ) } break;
+        case 100: { YY_USER_ACTION TOKEN( '}' ) } break;
+        case 101: { YY_USER_ACTION TOKEN( '(' ) } break;
+        case 102: { YY_USER_ACTION TOKEN( ')' ) } break;
+        case 103: { YY_USER_ACTION TOKEN( '?' ) } break;
+        case 104: { YY_USER_ACTION TOKEN( T_IDENTIFIER ) } break;
+        case 105: { YY_USER_ACTION TOKEN( T_CONSTANT ) } break;
+        case 106: { YY_USER_ACTION TOKEN( T_CONSTANT ) } break;
+        case 107: { YY_USER_ACTION TOKEN( T_CONSTANT ) } break;
+        case 108: { YY_USER_ACTION TOKEN( T_FCONST ) } break;
+        case 109: { YY_USER_ACTION TOKEN( T_FCONST ) } break;
+        case 110: { YY_USER_ACTION STRINGTOKEN( T_SCONST ) } break;
+        case 111: { YY_USER_ACTION throw ASTExceptionSyntaxError( { yyget_extra( yyscanner ), yylineno, yylineno } ); } break;
+        }
+    }
+}
+
+std::string parse_escape_characters( std::string str )
+{
+    std::string::size_type pos = str.find( '\\' );
+    while( pos != std::string::npos ) {
+        switch( str[ pos + 1 ] ) {
+        case 'r': str.replace( pos, 2, 1, '\r' ); break;
+        case 'n': str.replace( pos, 2, 1, '\n' ); break;
+        case 't': str.replace( pos, 2, 1, '\t' ); break;
+        case '\\': str.replace( pos, 2, 1, '\\' ); break;
+        case '\"': str.replace( pos, 2, 1, '\"' ); break;
+        case 'x':
+            char c1 = str[ pos + 2 ];
+            if( c1 <= '9' ) c1 -= '0';
+            else if( c1 <= 'F' ) c1 -= 'A' - 10;
+            else c1 -= 'a' - 10;
+
+            char c2 = str[ pos + 3 ];
+            if( c2 <= '9' ) c2 -= '0';
+            else if( c2 <= 'F' ) c2 -= 'A' - 10;
+            else c2 -= 'a' - 10;
+
+            str.replace( pos, 4, 1, (c1 << 4) | c2 );
+            break;
+        }
+        pos = str.find( '\\', pos + 1 );
+    }
+
+    return str;
+}
+
@@ -0,0 +1,19 @@
+#ifndef __fake_lexer_h__
+#define __fake_lexer_h__
+#include <stdio.h>
+typedef void* yyscan_t;
+struct yy_buffer_state;
+typedef yy_buffer_state* YY_BUFFER_STATE;
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+int yylex_init( yyscan_t* scanner );
+int yylex_destroy( yyscan_t scanner );
+void yyset_extra( const char* extra, yyscan_t scanner );
+const char* yyget_extra( yyscan_t scanner );
+YY_BUFFER_STATE yy_create_buffer( FILE* file, int size, yyscan_t scanner );
+YY_BUFFER_STATE yy_scan_string( const char* str, yyscan_t scanner );
+YY_BUFFER_STATE yy_scan_bytes( const char* bytes, int len, yyscan_t scanner );
+void yy_switch_to_buffer( YY_BUFFER_STATE buffer, yyscan_t scanner );
+void yy_delete_buffer( YY_BUFFER_STATE buffer, yyscan_t scanner );
+#endif
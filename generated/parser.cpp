@@ -0,0 +1,3503 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 26 "src/parser.y"
+
+
+#include <iostream>
+#include <utility>
+#include <stdio.h>
+
+#include "mempeek_parser.h"
+#include "mempeek_ast.h"
+
+using namespace std;
+
+static size_t arrayarg_counter = 0;
+static size_t arrayarg_depth = 0;
+
+static ASTNodePrint::ptr printnode = nullptr;
+
+// the scanner is a TokenStream, see tokencache.h
+int yylex( yyvalue_t*, YYLTYPE*, yyscan_t );
+
+void yyerror( YYLTYPE* yylloc, yyscan_t, yyenv_t, yynodeptr_t&, const char* ) { throw ASTExceptionSyntaxError( *yylloc ); }
+
+// do not allow the parser stack to grow because the value type has nontrivial construction
+#define yyoverflow( a, b, c, d, e, f, g, h ) yyerror( &yylloc, scanner, env, yyroot, (a) )
+
+void yyarg_start()
+{
+    arrayarg_depth++;
+}
+
+void yyarg_end()
+{
+    if( --arrayarg_depth == 0 ) arrayarg_counter = 0;
+}
+
+arglist_t::value_type yyfuncarg( const yylloc_t& location, Environment* env, std::string func, const arglist_t& args )
+{
+	try {
+		ASTNode::ptr node = env->get_function( location, func, args );
+		return make_pair( node, string( "" ) );
+	}
+	catch( ASTExceptionNamingConflict& ) {
+		string result = "@arg" + to_string( arrayarg_counter++ );
+		env->alloc_array( result );
+		ASTNode::ptr node = env->get_arrayfunc( location, func, result, args );
+		return make_pair( node, result );
+	}
+}
+
+arglist_t::value_type yystringarg( const yylloc_t& location, Environment* env, std::string value )
+{
+    string result = "@arg" + to_string( arrayarg_counter++ );
+    env->alloc_array( result );
+    ASTNode::ptr node = make_node<ASTNodeString>( location, env, result, value );
+    return make_pair( node, result );
+}
+
+
+#line 129 "generated/parser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* T_END_OF_STATEMENT  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_T_DEF = 3,                      /* T_DEF  */
+  YYSYMBOL_T_FROM = 4,                     /* T_FROM  */
+  YYSYMBOL_T_DIM = 5,                      /* T_DIM  */
+  YYSYMBOL_T_MAP = 6,                      /* T_MAP  */
+  YYSYMBOL_T_AT = 7,                       /* T_AT  */
+  YYSYMBOL_T_DEFPROC = 8,                  /* T_DEFPROC  */
+  YYSYMBOL_T_ENDPROC = 9,                  /* T_ENDPROC  */
+  YYSYMBOL_T_DEFFUNC = 10,                 /* T_DEFFUNC  */
+  YYSYMBOL_T_ENDFUNC = 11,                 /* T_ENDFUNC  */
+  YYSYMBOL_T_ELLIPSIS = 12,                /* T_ELLIPSIS  */
+  YYSYMBOL_T_ARGS = 13,                    /* T_ARGS  */
+  YYSYMBOL_T_DROP = 14,                    /* T_DROP  */
+  YYSYMBOL_T_EXIT = 15,                    /* T_EXIT  */
+  YYSYMBOL_T_GLOBAL = 16,                  /* T_GLOBAL  */
+  YYSYMBOL_T_STATIC = 17,                  /* T_STATIC  */
+  YYSYMBOL_T_IMPORT = 18,                  /* T_IMPORT  */
+  YYSYMBOL_T_RUN = 19,                     /* T_RUN  */
+  YYSYMBOL_T_PEEK = 20,                    /* T_PEEK  */
+  YYSYMBOL_T_POKE = 21,                    /* T_POKE  */
+  YYSYMBOL_T_MASK = 22,                    /* T_MASK  */
+  YYSYMBOL_T_PEEKBLOCK = 23,               /* T_PEEKBLOCK  */
+  YYSYMBOL_T_POKEBLOCK = 24,               /* T_POKEBLOCK  */
+  YYSYMBOL_T_MEMFIND = 25,                 /* T_MEMFIND  */
+  YYSYMBOL_T_IF = 26,                      /* T_IF  */
+  YYSYMBOL_T_THEN = 27,                    /* T_THEN  */
+  YYSYMBOL_T_ELSE = 28,                    /* T_ELSE  */
+  YYSYMBOL_T_ENDIF = 29,                   /* T_ENDIF  */
+  YYSYMBOL_T_WHILE = 30,                   /* T_WHILE  */
+  YYSYMBOL_T_DO = 31,                      /* T_DO  */
+  YYSYMBOL_T_ENDWHILE = 32,                /* T_ENDWHILE  */
+  YYSYMBOL_T_FOR = 33,                     /* T_FOR  */
+  YYSYMBOL_T_TO = 34,                      /* T_TO  */
+  YYSYMBOL_T_STEP = 35,                    /* T_STEP  */
+  YYSYMBOL_T_ENDFOR = 36,                  /* T_ENDFOR  */
+  YYSYMBOL_T_EVERY = 37,                   /* T_EVERY  */
+  YYSYMBOL_T_CATCHUP = 38,                 /* T_CATCHUP  */
+  YYSYMBOL_T_ENDEVERY = 39,                /* T_ENDEVERY  */
+  YYSYMBOL_T_GUARD = 40,                   /* T_GUARD  */
+  YYSYMBOL_T_ENDGUARD = 41,                /* T_ENDGUARD  */
+  YYSYMBOL_T_PRINT = 42,                   /* T_PRINT  */
+  YYSYMBOL_T_DEC = 43,                     /* T_DEC  */
+  YYSYMBOL_T_HEX = 44,                     /* T_HEX  */
+  YYSYMBOL_T_BIN = 45,                     /* T_BIN  */
+  YYSYMBOL_T_NEG = 46,                     /* T_NEG  */
+  YYSYMBOL_T_FLOAT = 47,                   /* T_FLOAT  */
+  YYSYMBOL_T_ARRAY = 48,                   /* T_ARRAY  */
+  YYSYMBOL_T_STRING = 49,                  /* T_STRING  */
+  YYSYMBOL_T_NOENDL = 50,                  /* T_NOENDL  */
+  YYSYMBOL_T_SLEEP = 51,                   /* T_SLEEP  */
+  YYSYMBOL_T_UNTIL = 52,                   /* T_UNTIL  */
+  YYSYMBOL_T_NOW = 53,                     /* T_NOW  */
+  YYSYMBOL_T_BREAK = 54,                   /* T_BREAK  */
+  YYSYMBOL_T_QUIT = 55,                    /* T_QUIT  */
+  YYSYMBOL_T_PRAGMA = 56,                  /* T_PRAGMA  */
+  YYSYMBOL_T_WORDSIZE = 57,                /* T_WORDSIZE  */
+  YYSYMBOL_T_LOADPATH = 58,                /* T_LOADPATH  */
+  YYSYMBOL_T_MEMOIZE = 59,                 /* T_MEMOIZE  */
+  YYSYMBOL_T_BIT_NOT = 60,                 /* T_BIT_NOT  */
+  YYSYMBOL_T_LOG_NOT = 61,                 /* T_LOG_NOT  */
+  YYSYMBOL_T_BIT_AND = 62,                 /* T_BIT_AND  */
+  YYSYMBOL_T_LOG_AND = 63,                 /* T_LOG_AND  */
+  YYSYMBOL_T_BIT_XOR = 64,                 /* T_BIT_XOR  */
+  YYSYMBOL_T_LOG_XOR = 65,                 /* T_LOG_XOR  */
+  YYSYMBOL_T_BIT_OR = 66,                  /* T_BIT_OR  */
+  YYSYMBOL_T_LOG_OR = 67,                  /* T_LOG_OR  */
+  YYSYMBOL_T_LSHIFT = 68,                  /* T_LSHIFT  */
+  YYSYMBOL_T_RSHIFT = 69,                  /* T_RSHIFT  */
+  YYSYMBOL_T_PLUS = 70,                    /* T_PLUS  */
+  YYSYMBOL_T_MINUS = 71,                   /* T_MINUS  */
+  YYSYMBOL_T_MUL = 72,                     /* T_MUL  */
+  YYSYMBOL_T_DIV = 73,                     /* T_DIV  */
+  YYSYMBOL_T_MOD = 74,                     /* T_MOD  */
+  YYSYMBOL_T_SDIV = 75,                    /* T_SDIV  */
+  YYSYMBOL_T_SMOD = 76,                    /* T_SMOD  */
+  YYSYMBOL_T_LT = 77,                      /* T_LT  */
+  YYSYMBOL_T_GT = 78,                      /* T_GT  */
+  YYSYMBOL_T_LE = 79,                      /* T_LE  */
+  YYSYMBOL_T_GE = 80,                      /* T_GE  */
+  YYSYMBOL_T_EQ = 81,                      /* T_EQ  */
+  YYSYMBOL_T_NE = 82,                      /* T_NE  */
+  YYSYMBOL_T_SLT = 83,                     /* T_SLT  */
+  YYSYMBOL_T_SGT = 84,                     /* T_SGT  */
+  YYSYMBOL_T_SLE = 85,                     /* T_SLE  */
+  YYSYMBOL_T_SGE = 86,                     /* T_SGE  */
+  YYSYMBOL_T_ASSIGN = 87,                  /* T_ASSIGN  */
+  YYSYMBOL_T_8BIT = 88,                    /* T_8BIT  */
+  YYSYMBOL_T_16BIT = 89,                   /* T_16BIT  */
+  YYSYMBOL_T_32BIT = 90,                   /* T_32BIT  */
+  YYSYMBOL_T_64BIT = 91,                   /* T_64BIT  */
+  YYSYMBOL_T_IDENTIFIER = 92,              /* T_IDENTIFIER  */
+  YYSYMBOL_T_CONSTANT = 93,                /* T_CONSTANT  */
+  YYSYMBOL_T_FCONST = 94,                  /* T_FCONST  */
+  YYSYMBOL_T_SCONST = 95,                  /* T_SCONST  */
+  YYSYMBOL_96_ = 96,                       /* '('  */
+  YYSYMBOL_97_ = 97,                       /* ')'  */
+  YYSYMBOL_98_ = 98,                       /* '['  */
+  YYSYMBOL_99_ = 99,                       /* ']'  */
+  YYSYMBOL_100_ = 100,                     /* ','  */
+  YYSYMBOL_101_ = 101,                     /* '{'  */
+  YYSYMBOL_102_ = 102,                     /* '}'  */
+  YYSYMBOL_103_ = 103,                     /* '?'  */
+  YYSYMBOL_104_ = 104,                     /* '.'  */
+  YYSYMBOL_YYACCEPT = 105,                 /* $accept  */
+  YYSYMBOL_start = 106,                    /* start  */
+  YYSYMBOL_toplevel_block = 107,           /* toplevel_block  */
+  YYSYMBOL_block = 108,                    /* block  */
+  YYSYMBOL_subroutine_block = 109,         /* subroutine_block  */
+  YYSYMBOL_110_1 = 110,                    /* @1  */
+  YYSYMBOL_toplevel_statement = 111,       /* toplevel_statement  */
+  YYSYMBOL_statement = 112,                /* statement  */
+  YYSYMBOL_subroutine_statement = 113,     /* subroutine_statement  */
+  YYSYMBOL_proc_def = 114,                 /* proc_def  */
+  YYSYMBOL_115_2 = 115,                    /* $@2  */
+  YYSYMBOL_116_3 = 116,                    /* $@3  */
+  YYSYMBOL_func_def = 117,                 /* func_def  */
+  YYSYMBOL_118_4 = 118,                    /* $@4  */
+  YYSYMBOL_119_5 = 119,                    /* $@5  */
+  YYSYMBOL_arrayfunc_def = 120,            /* arrayfunc_def  */
+  YYSYMBOL_proc_arg_decl = 121,            /* proc_arg_decl  */
+  YYSYMBOL_proc_arg_list = 122,            /* proc_arg_list  */
+  YYSYMBOL_func_arg_decl = 123,            /* func_arg_decl  */
+  YYSYMBOL_func_arg_list = 124,            /* func_arg_list  */
+  YYSYMBOL_proc_args = 125,                /* proc_args  */
+  YYSYMBOL_126_6 = 126,                    /* $@6  */
+  YYSYMBOL_proc_args_items = 127,          /* proc_args_items  */
+  YYSYMBOL_func_args = 128,                /* func_args  */
+  YYSYMBOL_129_7 = 129,                    /* $@7  */
+  YYSYMBOL_func_args_items = 130,          /* func_args_items  */
+  YYSYMBOL_subroutine_arg = 131,           /* subroutine_arg  */
+  YYSYMBOL_global_stmt = 132,              /* global_stmt  */
+  YYSYMBOL_static_stmt = 133,              /* static_stmt  */
+  YYSYMBOL_drop_stmt = 134,                /* drop_stmt  */
+  YYSYMBOL_if_block = 135,                 /* if_block  */
+  YYSYMBOL_if_def = 136,                   /* if_def  */
+  YYSYMBOL_else_def = 137,                 /* else_def  */
+  YYSYMBOL_while_block = 138,              /* while_block  */
+  YYSYMBOL_for_block = 139,                /* for_block  */
+  YYSYMBOL_for_def = 140,                  /* for_def  */
+  YYSYMBOL_every_block = 141,              /* every_block  */
+  YYSYMBOL_every_def = 142,                /* every_def  */
+  YYSYMBOL_every_policy = 143,             /* every_policy  */
+  YYSYMBOL_guard_block = 144,              /* guard_block  */
+  YYSYMBOL_assign_stmt = 145,              /* assign_stmt  */
+  YYSYMBOL_def_stmt = 146,                 /* def_stmt  */
+  YYSYMBOL_dim_stmt = 147,                 /* dim_stmt  */
+  YYSYMBOL_comma_list = 148,               /* comma_list  */
+  YYSYMBOL_map_stmt = 149,                 /* map_stmt  */
+  YYSYMBOL_pragma_stmt = 150,              /* pragma_stmt  */
+  YYSYMBOL_import_stmt = 151,              /* import_stmt  */
+  YYSYMBOL_poke_stmt = 152,                /* poke_stmt  */
+  YYSYMBOL_poke_token = 153,               /* poke_token  */
+  YYSYMBOL_block_stmt = 154,               /* block_stmt  */
+  YYSYMBOL_peekblock_token = 155,          /* peekblock_token  */
+  YYSYMBOL_pokeblock_token = 156,          /* pokeblock_token  */
+  YYSYMBOL_memfind_token = 157,            /* memfind_token  */
+  YYSYMBOL_size_suffix = 158,              /* size_suffix  */
+  YYSYMBOL_print_stmt = 159,               /* print_stmt  */
+  YYSYMBOL_print_stmt_endl = 160,          /* print_stmt_endl  */
+  YYSYMBOL_161_8 = 161,                    /* $@8  */
+  YYSYMBOL_print_args = 162,               /* print_args  */
+  YYSYMBOL_print_array = 163,              /* print_array  */
+  YYSYMBOL_print_float = 164,              /* print_float  */
+  YYSYMBOL_print_format = 165,             /* print_format  */
+  YYSYMBOL_print_size = 166,               /* print_size  */
+  YYSYMBOL_sleep_stmt = 167,               /* sleep_stmt  */
+  YYSYMBOL_expression = 168,               /* expression  */
+  YYSYMBOL_and_expr = 169,                 /* and_expr  */
+  YYSYMBOL_comp_expr = 170,                /* comp_expr  */
+  YYSYMBOL_add_expr = 171,                 /* add_expr  */
+  YYSYMBOL_mul_expr = 172,                 /* mul_expr  */
+  YYSYMBOL_shift_expr = 173,               /* shift_expr  */
+  YYSYMBOL_unary_expr = 174,               /* unary_expr  */
+  YYSYMBOL_atomic_expr = 175,              /* atomic_expr  */
+  YYSYMBOL_args_expr = 176,                /* args_expr  */
+  YYSYMBOL_peek_token = 177,               /* peek_token  */
+  YYSYMBOL_var_identifier = 178,           /* var_identifier  */
+  YYSYMBOL_array_identifier = 179,         /* array_identifier  */
+  YYSYMBOL_struct_identifier = 180,        /* struct_identifier  */
+  YYSYMBOL_plain_identifier = 181          /* plain_identifier  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  114
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1416
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  105
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  77
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  234
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  469
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   350
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      96,    97,     2,     2,   100,     2,   104,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   103,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    98,     2,    99,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   101,     2,   102,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   131,   131,   134,   135,   138,   139,   142,   142,   144,
+     147,   148,   149,   150,   151,   152,   153,   154,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   175,   176,   177,   185,   188,   185,
+     192,   195,   192,   199,   200,   203,   204,   205,   208,   209,
+     210,   213,   214,   215,   218,   219,   220,   221,   222,   225,
+     225,   229,   230,   233,   234,   234,   238,   239,   242,   243,
+     244,   245,   248,   249,   252,   254,   256,   258,   262,   263,
+     271,   272,   273,   274,   277,   280,   281,   284,   285,   290,
+     291,   296,   297,   300,   301,   306,   307,   310,   311,   314,
+     324,   325,   327,   328,   330,   332,   334,   338,   339,   340,
+     341,   342,   345,   346,   349,   350,   351,   359,   360,   361,
+     362,   366,   367,   368,   369,   370,   371,   372,   375,   376,
+     379,   380,   383,   384,   387,   388,   389,   391,   395,   396,
+     399,   400,   403,   404,   407,   408,   409,   410,   413,   414,
+     417,   417,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   432,   433,   435,   438,   439,   440,   441,   444,   445,
+     446,   447,   450,   451,   459,   460,   461,   464,   465,   468,
+     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
+     481,   482,   483,   484,   485,   488,   489,   490,   491,   492,
+     493,   494,   497,   498,   499,   502,   503,   504,   505,   508,
+     509,   510,   511,   512,   513,   514,   515,   517,   519,   522,
+     523,   524,   525,   526,   529,   530,   533,   534,   535,   536,
+     537,   540,   541,   544,   547
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "T_END_OF_STATEMENT", "error", "\"invalid token\"", "T_DEF", "T_FROM",
+  "T_DIM", "T_MAP", "T_AT", "T_DEFPROC", "T_ENDPROC", "T_DEFFUNC",
+  "T_ENDFUNC", "T_ELLIPSIS", "T_ARGS", "T_DROP", "T_EXIT", "T_GLOBAL",
+  "T_STATIC", "T_IMPORT", "T_RUN", "T_PEEK", "T_POKE", "T_MASK",
+  "T_PEEKBLOCK", "T_POKEBLOCK", "T_MEMFIND", "T_IF", "T_THEN", "T_ELSE",
+  "T_ENDIF", "T_WHILE", "T_DO", "T_ENDWHILE", "T_FOR", "T_TO", "T_STEP",
+  "T_ENDFOR", "T_EVERY", "T_CATCHUP", "T_ENDEVERY", "T_GUARD",
+  "T_ENDGUARD", "T_PRINT", "T_DEC", "T_HEX", "T_BIN", "T_NEG", "T_FLOAT",
+  "T_ARRAY", "T_STRING", "T_NOENDL", "T_SLEEP", "T_UNTIL", "T_NOW",
+  "T_BREAK", "T_QUIT", "T_PRAGMA", "T_WORDSIZE", "T_LOADPATH", "T_MEMOIZE",
+  "T_BIT_NOT", "T_LOG_NOT", "T_BIT_AND", "T_LOG_AND", "T_BIT_XOR",
+  "T_LOG_XOR", "T_BIT_OR", "T_LOG_OR", "T_LSHIFT", "T_RSHIFT", "T_PLUS",
+  "T_MINUS", "T_MUL", "T_DIV", "T_MOD", "T_SDIV", "T_SMOD", "T_LT", "T_GT",
+  "T_LE", "T_GE", "T_EQ", "T_NE", "T_SLT", "T_SGT", "T_SLE", "T_SGE",
+  "T_ASSIGN", "T_8BIT", "T_16BIT", "T_32BIT", "T_64BIT", "T_IDENTIFIER",
+  "T_CONSTANT", "T_FCONST", "T_SCONST", "'('", "')'", "'['", "']'", "','",
+  "'{'", "'}'", "'?'", "'.'", "$accept", "start", "toplevel_block",
+  "block", "subroutine_block", "@1", "toplevel_statement", "statement",
+  "subroutine_statement", "proc_def", "$@2", "$@3", "func_def", "$@4",
+  "$@5", "arrayfunc_def", "proc_arg_decl", "proc_arg_list",
+  "func_arg_decl", "func_arg_list", "proc_args", "$@6", "proc_args_items",
+  "func_args", "$@7", "func_args_items", "subroutine_arg", "global_stmt",
+  "static_stmt", "drop_stmt", "if_block", "if_def", "else_def",
+  "while_block", "for_block", "for_def", "every_block", "every_def",
+  "every_policy", "guard_block", "assign_stmt", "def_stmt", "dim_stmt",
+  "comma_list", "map_stmt", "pragma_stmt", "import_stmt", "poke_stmt",
+  "poke_token", "block_stmt", "peekblock_token", "pokeblock_token",
+  "memfind_token", "size_suffix", "print_stmt", "print_stmt_endl", "$@8",
+  "print_args", "print_array", "print_float", "print_format", "print_size",
+  "sleep_stmt", "expression", "and_expr", "comp_expr", "add_expr",
+  "mul_expr", "shift_expr", "unary_expr", "atomic_expr", "args_expr",
+  "peek_token", "var_identifier", "array_identifier", "struct_identifier",
+  "plain_identifier", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-323)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-159)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     789,   -83,   249,  1310,   -50,   -66,   -50,    46,   -42,   -27,
+     230,   230,   230,   230,  1310,  1310,   -50,  1310,    75,  -323,
+    1260,   104,   110,   181,  -323,   153,   789,  -323,  -323,  -323,
+    -323,   162,  -323,   502,  -323,  -323,   547,  -323,   591,  -323,
+     168,   171,   191,   241,   255,   265,   266,  1310,   267,   -50,
+    1310,   -50,   277,    88,   284,   -64,    61,   763,  1310,  -323,
+    -323,  -323,  -323,   -50,   109,   188,   230,  -323,   297,   297,
+     297,  -323,  -323,  1310,   199,  1210,   239,  -323,  1330,   304,
+      57,  -323,  -323,  -323,   200,  -323,  -323,   205,   156,  -323,
+     214,   -50,   219,  -323,  -323,  -323,  -323,  -323,  -323,  -323,
+      66,   -15,   319,   154,  1174,  -323,  1310,   169,  -323,  -323,
+     316,   231,   236,   -50,  -323,  -323,  -323,  1174,   305,  1174,
+    -323,  1174,  -323,  -323,  -323,  -323,  -323,  -323,  -323,  -323,
+    1210,  -323,   237,   151,   247,  -323,  -323,  -323,  1310,  1160,
+     328,  -323,   242,  1310,   256,   169,    44,   248,  1310,   391,
+    -323,  -323,  -323,  -323,   159,  1310,  1310,  1310,    12,  1310,
+    1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,
+    1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,  1310,
+    1310,  1310,  1310,   653,   259,   697,   355,  -323,  -323,   271,
+    -323,   635,  1310,  -323,   -18,  1002,  -323,  1247,   169,  -323,
+    -323,  -323,  -323,  -323,  -323,  -323,  -323,  -323,   310,  -323,
+    -323,   285,   937,   679,  -323,  1044,  1067,     2,   286,   296,
+     303,   169,   308,   -39,  -323,  1297,  -323,   -45,  1310,   -50,
+    1310,   -28,   281,   -24,  -323,   -16,   239,   239,  1310,   377,
+    -323,   304,   304,   304,   304,   209,   209,   209,   209,   209,
+     209,   209,   209,   209,   209,    57,    57,    57,    57,    57,
+      57,  -323,  -323,   165,   294,    72,   312,  1297,   313,    83,
+    -323,   413,    -9,   318,  -323,  1174,  -323,   121,  -323,   317,
+     417,  -323,  -323,  -323,  -323,   310,   169,   161,  -323,  -323,
+    -323,  -323,  -323,   324,   422,  -323,  1174,  -323,   423,   425,
+    1310,  1310,   331,  1310,    23,   340,  -323,  -323,   169,   203,
+    1310,    76,  -323,   102,  -323,  -323,   336,  1310,   169,  1310,
+    -323,  -323,  -323,  -323,   338,  -323,  -323,  -323,  -323,  -323,
+     341,    -5,  1109,  1310,   342,  -323,  -323,   259,    20,  -323,
+    -323,  1132,  -323,  -323,   169,  1210,  1310,  1210,   345,  -323,
+    1310,   207,  1310,   259,   189,   169,  1310,  -323,   233,    77,
+     169,  1297,   853,   979,   343,  -323,   346,   347,   350,   449,
+      89,   419,   357,  -323,   455,   169,   169,  1210,  1310,    98,
+     169,   259,   358,   169,   363,  -323,   169,   368,   373,   105,
+    1310,  -323,  -323,   -50,   -50,  -323,  -323,  -323,  -323,  -323,
+    -323,   482,    -2,   387,  -323,  -323,  1310,  -323,   420,  -323,
+      63,    82,  -323,  1310,   393,  -323,     5,  -323,  -323,  -323,
+      99,   492,     8,   -60,  -323,  -323,   395,  -323,   120,  1310,
+     397,   169,  -323,  -323,  1310,  -323,  -323,   398,  1310,  1190,
+     895,   400,  -323,   169,   401,   166,   501,    21,   416,   138,
+    -323,  -323,  -323,  -323,  -323,  -323,   -63,   504,   505,  1310,
+     408,  -323,  -323,   129,   409,   509,   510,  -323,  -323
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+      18,     0,     0,     0,     0,    43,     0,     0,     0,     0,
+     132,   138,   140,   142,     0,     0,     0,     0,     0,   150,
+       0,     0,     0,     0,   234,     0,     2,     3,    10,    15,
+      16,     0,    28,    18,    29,    30,    18,    31,    18,    32,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   148,     0,    59,   234,     0,     0,   144,
+     145,   146,   147,     0,     0,     0,   224,   211,     0,     0,
+       0,   209,   210,     0,     0,     0,   176,   178,   189,   194,
+     201,   204,   208,   214,     0,   212,   230,   227,   226,    37,
+       0,     0,    78,    25,   128,   129,   133,   139,   141,   143,
+       0,     0,     0,    97,    18,   152,     0,   172,    26,    27,
+       0,     0,     0,     0,     1,     4,    17,    18,    80,    18,
+      89,    18,    93,    20,    13,    19,    12,    11,    14,    21,
+       0,    22,     0,     0,     0,    23,   149,    24,     0,     0,
+       0,    61,     0,     0,     0,   108,   107,     0,     0,     0,
+     225,   206,   207,   205,     0,     0,     0,     0,   117,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    64,     0,    48,    44,    40,     0,
+      84,    18,     0,    98,     0,     0,     5,   151,   173,   164,
+     165,   166,   167,   163,   161,   162,   121,   122,   123,   125,
+     126,     0,     0,    18,    81,     0,     0,   130,     0,     0,
+       0,   100,     0,     0,    33,    60,   233,     0,     0,     0,
+       0,     0,     0,     0,   213,     0,   175,   174,     0,   119,
+     177,   193,   192,   190,   191,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   200,   195,   196,   197,   198,
+     199,   202,   203,     0,     0,     0,     0,     0,     0,     0,
+      47,     0,    45,     0,    79,    18,    87,     0,    95,     0,
+       0,     6,   157,   153,   154,   155,   160,   226,   168,   169,
+     170,   171,   124,     0,     0,    83,    18,    85,     0,     0,
+       0,     0,     0,     0,     0,     0,    68,    62,    71,   226,
+       0,     0,   111,     0,   112,   219,   221,     0,   118,     0,
+     215,   228,   229,   218,    65,    66,   231,   232,     7,    46,
+      49,    54,     0,     0,     0,    99,   156,    64,     0,   127,
+      82,     0,    90,    94,   131,     0,     0,     0,     0,   102,
+     114,     0,     0,    64,     0,   109,     0,   113,     0,     0,
+     120,     0,     0,    18,     0,    53,     0,    51,    55,     0,
+       0,     0,     0,   159,     0,   134,   135,     0,     0,     0,
+     115,    64,     0,   101,     0,    70,   110,     0,     0,     0,
+       0,    67,    38,     0,     0,    34,     9,    35,    36,     8,
+      50,     0,     0,     0,    88,    91,     0,    96,   218,    86,
+     136,     0,   104,     0,     0,   103,   218,   220,   222,   223,
+       0,     0,     0,     0,     7,    52,    57,    56,     0,     0,
+       0,   116,   106,   216,     0,    39,    72,     0,     0,     0,
+       0,     0,    92,   137,     0,     0,     0,     0,     0,     0,
+      41,    58,   105,   217,    73,    74,     0,     0,     0,   114,
+       0,    75,    42,     0,     0,     0,     0,    76,    77
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -323,  -323,  -323,  -115,    87,  -323,   495,    56,   167,  -323,
+    -323,  -323,  -323,  -323,  -323,  -323,  -323,  -323,  -323,  -323,
+    -323,  -323,  -323,  -322,  -323,  -323,  -266,  -323,  -323,  -323,
+    -323,  -323,   321,  -323,  -323,  -323,  -323,  -323,  -323,  -323,
+    -323,  -323,  -323,    65,  -323,  -323,  -323,  -323,  -323,  -323,
+    -323,  -323,    96,    51,  -323,  -323,  -323,  -323,   325,   332,
+     334,   252,  -323,    -3,    19,   375,   571,   245,   300,    64,
+     142,  -323,  -323,  -323,  -323,   537,   157
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    25,    26,   195,   362,   363,    27,   196,   396,    29,
+     186,   421,    30,   273,   458,    91,   271,   272,   366,   367,
+     140,   141,   225,   266,   267,   324,   307,   397,   398,    31,
+      32,    33,   214,    34,    35,    36,    37,    38,   194,    39,
+      40,    41,    42,   379,    43,    44,    45,    46,    47,    48,
+      49,    50,    74,    63,    52,    53,   105,   197,   206,   207,
+     208,   292,    54,   269,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      75,   325,   212,   329,   215,   -69,   216,   365,   436,    56,
+     425,   100,   101,   278,   103,   372,   191,   107,   -69,   238,
+     156,   455,   157,   138,   300,   -69,   156,   438,   157,    24,
+     -69,   384,    90,    65,   139,   459,   348,   156,   439,   157,
+      66,   156,    24,   157,   130,    13,    93,   133,   229,   156,
+     156,   157,   157,    94,   145,   146,    28,   310,   -69,   414,
+     305,    96,    97,    98,    99,   -69,   -69,   156,    95,   157,
+     154,   314,   158,    67,    24,   104,   -69,   156,   316,   157,
+      68,    69,    28,    24,   317,   429,   156,    24,   157,   118,
+      24,    70,   120,   190,   122,   391,    51,   -69,   -69,   -69,
+     -69,   -69,   -69,   198,   108,   -69,   437,   239,   144,   156,
+     109,   157,    56,    71,    72,    24,    73,   150,   349,   373,
+     405,   350,    51,   268,   406,   180,   181,   217,   156,    51,
+     157,   156,    51,   157,    51,   221,   223,   156,   136,   157,
+     227,   156,   156,   157,   157,   231,   233,   156,   156,   157,
+     157,   442,   235,   114,   156,   333,   157,    55,    58,    64,
+     332,    89,   116,    92,   156,   142,   157,   156,   123,   157,
+     156,   124,   157,   102,   322,   236,   237,   390,   356,   263,
+     265,   341,   327,    55,   430,   156,   156,   157,   157,   277,
+      55,   125,   193,    55,   286,    55,   433,   412,   413,   434,
+      51,   357,    65,   156,   419,   157,   132,   148,   134,    66,
+     151,   152,   153,    51,    13,    51,   156,    51,   157,   156,
+     147,   157,   308,   110,   156,   311,   157,   313,   465,   413,
+     156,   156,   157,   157,   156,   318,   157,   457,   111,   112,
+     113,   126,    67,    24,   261,   262,    65,   276,   188,    68,
+      69,   281,   184,    66,   185,   127,   234,   337,    13,   338,
+      70,    55,   320,   453,   308,   128,   129,   131,   281,   297,
+     211,   281,   281,   160,    55,   161,    55,   135,    55,   162,
+     163,    56,    71,    72,   137,    73,    67,    51,   385,   149,
+     219,    51,   268,    68,    69,   155,   182,   344,   345,   353,
+     347,   354,   159,   381,    70,   382,   183,   355,    51,    51,
+      65,    51,    51,   187,   359,   189,   360,    66,    59,    60,
+      61,    62,    13,   192,   209,    56,    71,    72,   224,    73,
+     370,   210,   387,   213,   226,   218,   388,    59,    60,    61,
+      62,    24,   375,   376,   377,   220,   230,   380,    55,   383,
+      67,   279,    55,   386,   287,   389,   -63,   228,   308,   199,
+     200,   201,   202,   203,   204,   205,   174,   270,   274,    55,
+      55,    51,    55,    55,   410,   411,   175,   176,   177,   178,
+     179,   293,   309,   315,   319,   301,   312,   420,   281,    56,
+      71,    72,    51,    73,   302,   304,   321,   281,   288,   289,
+     290,   291,   303,   428,    65,   241,   242,   243,   244,   323,
+     431,    66,   326,   328,   331,   334,    13,   335,   395,   395,
+    -158,   339,   340,   342,   309,   343,   443,   352,    51,   330,
+     346,   445,    55,  -158,   358,   447,   449,    51,   361,   364,
+    -158,   371,   400,   401,    67,  -158,   378,   402,   403,   404,
+     407,    68,    69,    55,   408,   409,   380,   415,    51,    51,
+     416,   351,    70,  -158,  -158,  -158,  -158,  -158,  -158,  -158,
+    -158,   417,   418,  -158,   255,   256,   257,   258,   259,   260,
+    -158,  -158,   424,    56,    71,    72,   427,    73,   368,    55,
+     432,  -158,   435,   441,   232,   444,   395,   446,    55,   451,
+     452,   454,   117,   456,   461,   462,   464,     2,   466,   467,
+     468,   440,  -158,  -158,  -158,  -158,  -158,     7,   309,    55,
+      55,   115,   283,    10,   463,    11,    12,    13,    14,   284,
+     399,   285,    15,   295,   240,    16,    51,   336,    57,    17,
+       0,     0,    18,     0,    19,     0,     0,   119,     0,     0,
+     422,   423,     2,    20,     0,     0,    21,    22,     0,   426,
+       0,     0,     7,     0,     0,     0,     0,     0,    10,     0,
+      11,    12,    13,    14,     0,     0,     0,    15,     0,     0,
+      16,     0,     0,     0,    17,     0,     0,    18,     0,    19,
+       0,   121,     0,     0,    24,     0,     2,    55,    20,     0,
+       0,    21,    22,     0,     0,     0,     7,     0,     0,     0,
+       0,     0,    10,   460,    11,    12,    13,    14,     0,     0,
+       0,    15,     0,     0,    16,     0,     0,     0,    17,     0,
+       0,    18,     0,    19,     0,   275,     0,     0,     0,    24,
+       2,     0,    20,     0,     0,    21,    22,     0,     0,     0,
+       7,     0,     0,     0,     0,     0,    10,     0,    11,    12,
+      13,    14,     0,     0,     0,    15,    65,     0,    16,     0,
+       0,     0,    17,    66,     0,    18,     0,    19,    13,   296,
+       0,     0,     0,    24,     2,     0,    20,     0,     0,    21,
+      22,     0,     0,     0,     7,     0,     0,     0,     0,     0,
+      10,     0,    11,    12,    13,    14,    67,     0,     0,    15,
+      65,     0,    16,    68,    69,     0,    17,    66,     0,    18,
+       0,    19,    13,     0,    70,     0,     0,    24,     0,     0,
+      20,     0,     0,    21,    22,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    56,    71,    72,     0,    73,
+      67,     0,     0,     0,     0,     0,   264,    68,    69,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    70,     0,
+       0,    24,     0,     0,     0,     0,    65,     0,     0,     0,
+       0,     0,     0,    66,     0,     0,     0,     0,    13,    56,
+      71,    72,     1,    73,     2,     3,     0,     4,     0,     5,
+     268,     0,     0,     6,     7,     0,     0,     8,     9,     0,
+      10,     0,    11,    12,    13,    14,    67,     0,     0,    15,
+       0,     0,    16,    68,    69,     0,    17,     0,     0,    18,
+       0,    19,     0,     0,    70,     0,     0,     0,     0,     0,
+      20,     0,     0,    21,    22,    23,     0,     0,     0,     0,
+       0,    59,    60,    61,    62,    56,    71,    72,     2,    73,
+       0,     0,   392,     0,   143,     0,     0,     0,     7,   393,
+     394,     0,     0,     0,    10,     0,    11,    12,    13,    14,
+       0,    24,     0,    15,     0,     0,    16,     0,     0,     0,
+      17,     0,     0,    18,     0,    19,     0,     0,     0,     0,
+       2,     0,     0,     0,    20,     0,   450,    21,    22,     0,
+       7,   393,   394,     0,     0,     0,    10,     0,    11,    12,
+      13,    14,     0,     0,     0,    15,     0,     0,    16,     0,
+       0,     0,    17,     0,     0,    18,     0,    19,     0,     0,
+       0,     0,     2,     0,     0,    24,    20,     0,     0,    21,
+      22,     0,     7,     0,     0,     0,     0,     0,    10,     0,
+      11,    12,    13,    14,     0,   213,   294,    15,     0,     0,
+      16,     0,     0,     0,    17,     0,     0,    18,     0,    19,
+       0,     0,     0,     0,     2,     0,     0,    24,    20,     0,
+       0,    21,    22,     0,     7,   393,   394,     0,     0,     0,
+      10,     0,    11,    12,    13,    14,     0,     2,     0,    15,
+       0,     0,    16,     0,     0,     0,    17,     7,     0,    18,
+       0,    19,     0,    10,     0,    11,    12,    13,    14,    24,
+      20,     0,    15,    21,    22,    16,     0,     0,     0,    17,
+       0,     0,    18,   280,    19,     0,     0,     0,     0,     2,
+       0,     0,     0,    20,     0,     0,    21,    22,     0,     7,
+       0,     0,     0,     0,     0,    10,     0,    11,    12,    13,
+      14,    24,     2,     0,    15,     0,     0,    16,     0,     0,
+     298,    17,     7,     0,    18,     0,    19,     0,    10,     0,
+      11,    12,    13,    14,    24,    20,     0,    15,    21,    22,
+      16,     0,     0,     0,    17,     0,   299,    18,     0,    19,
+       0,     0,     0,     0,     2,     0,     0,     0,    20,     0,
+       0,    21,    22,     0,     7,     0,     0,     0,     0,     0,
+      10,     0,    11,    12,    13,    14,    24,     2,     0,    15,
+       0,   369,    16,     0,     0,     0,    17,     7,     0,    18,
+       0,    19,     0,    10,     0,    11,    12,    13,    14,    24,
+      20,   374,    15,    21,    22,    16,     0,     0,     0,    17,
+       0,     0,    18,    65,    19,     0,     0,     0,     0,     2,
+      66,     0,     0,    20,     0,    13,    21,    22,     0,     7,
+       0,     0,     0,     0,     0,    10,     0,    11,    12,    13,
+      14,    24,     0,    65,    15,     0,     0,    16,     0,     0,
+      66,    17,     0,    67,    18,    13,    19,     0,     0,     0,
+      68,    69,     0,    65,    24,    20,     0,     0,    21,    22,
+      66,    70,     0,     0,     0,    13,     0,     0,     0,     0,
+       0,     0,     0,    67,     0,     0,     0,     0,     0,     0,
+      68,    69,    56,    71,    72,     0,    73,     0,     0,   222,
+      65,    70,     0,    67,     0,     0,    24,    66,     0,     0,
+      68,    69,    13,    65,     0,   156,     0,   157,     0,     0,
+      66,    70,    56,    71,    72,    13,    73,     0,     0,   448,
+     199,   200,   201,   202,   203,   204,   205,     0,     0,     0,
+      67,     0,    56,    71,    72,     0,    73,    68,    69,     0,
+      65,     0,   106,    67,     0,     0,     0,    66,    70,     0,
+      68,    69,    13,    65,     0,     0,     0,     0,     0,     0,
+      66,    70,     0,     0,     0,    13,     0,     0,     0,    56,
+      71,    72,   282,    73,     0,     0,     0,     0,     0,     0,
+      67,     0,    56,    71,    72,     0,    73,    68,    69,     0,
+       0,     0,     0,    67,     0,     0,     0,     0,    70,     0,
+      68,    69,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    70,     0,     0,     0,     0,     0,     0,     0,    56,
+      71,    72,   306,    73,   160,     0,   161,     0,     0,     0,
+     162,   163,    56,    71,    72,     0,    73,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173
+};
+
+static const yytype_int16 yycheck[] =
+{
+       3,   267,   117,    12,   119,     0,   121,    12,     0,    92,
+      12,    14,    15,    31,    17,   337,    31,    20,    13,     7,
+      65,     0,    67,    87,    22,    20,    65,    87,    67,    92,
+      25,   353,    98,    13,    98,    98,    13,    65,    98,    67,
+      20,    65,    92,    67,    47,    25,     0,    50,     4,    65,
+      65,    67,    67,    95,    57,    58,     0,   102,    53,   381,
+      99,    10,    11,    12,    13,    60,    61,    65,    95,    67,
+      73,    99,    75,    53,    92,     0,    71,    65,   102,    67,
+      60,    61,    26,    92,   100,    22,    65,    92,    67,    33,
+      92,    71,    36,    27,    38,   361,     0,    92,    93,    94,
+      95,    96,    97,   106,     0,   100,    98,    95,    57,    65,
+       0,    67,    92,    93,    94,    92,    96,    66,    95,    99,
+      31,    98,    26,   103,    35,    68,    69,   130,    65,    33,
+      67,    65,    36,    67,    38,   138,   139,    65,    50,    67,
+     143,    65,    65,    67,    67,   148,   149,    65,    65,    67,
+      67,    31,   155,     0,    65,    34,    67,     0,     1,     2,
+     275,     4,     0,     6,    65,   104,    67,    65,     0,    67,
+      65,     0,    67,    16,   102,   156,   157,   100,   102,   182,
+     183,   296,    99,    26,   102,    65,    65,    67,    67,   192,
+      33,     0,    38,    36,   197,    38,    97,    99,   100,   100,
+     104,    99,    13,    65,    99,    67,    49,    98,    51,    20,
+      68,    69,    70,   117,    25,   119,    65,   121,    67,    65,
+      63,    67,   225,    42,    65,   228,    67,   230,    99,   100,
+      65,    65,    67,    67,    65,   238,    67,    99,    57,    58,
+      59,     0,    53,    92,   180,   181,    13,   191,    91,    60,
+      61,   195,    96,    20,    98,     0,    97,    96,    25,    98,
+      71,   104,    97,    97,   267,     0,     0,     0,   212,   213,
+     113,   215,   216,    64,   117,    66,   119,     0,   121,    70,
+      71,    92,    93,    94,     0,    96,    53,   191,    99,   101,
+     133,   195,   103,    60,    61,    96,    96,   300,   301,    96,
+     303,    98,    63,    96,    71,    98,   101,   310,   212,   213,
+      13,   215,   216,    99,   317,    96,   319,    20,    88,    89,
+      90,    91,    25,     4,    93,    92,    93,    94,     0,    96,
+     333,    95,    99,    28,    92,    98,   103,    88,    89,    90,
+      91,    92,   345,   346,   347,    98,    98,   350,   191,   352,
+      53,   194,   195,   356,   197,   358,    97,   101,   361,    43,
+      44,    45,    46,    47,    48,    49,    62,    12,    97,   212,
+     213,   275,   215,   216,   377,   378,    72,    73,    74,    75,
+      76,    96,   225,   102,     7,    99,   229,   390,   332,    92,
+      93,    94,   296,    96,    98,    87,   102,   341,    88,    89,
+      90,    91,    99,   406,    13,   160,   161,   162,   163,    97,
+     413,    20,    99,     0,    96,    98,    25,     0,   362,   363,
+       0,    97,     0,     0,   267,     0,   429,    87,   332,   272,
+      99,   434,   275,    13,    98,   438,   439,   341,   100,    98,
+      20,    99,    99,    97,    53,    25,   101,   100,    98,     0,
+      31,    60,    61,   296,    97,     0,   459,    99,   362,   363,
+      97,   304,    71,    43,    44,    45,    46,    47,    48,    49,
+      50,   103,    99,    53,   174,   175,   176,   177,   178,   179,
+      60,    61,     0,    92,    93,    94,    99,    96,   331,   332,
+      97,    71,     0,    98,   103,    98,   440,    99,   341,    99,
+      99,     0,     0,    87,     0,     0,    98,     5,    99,     0,
+       0,   424,    92,    93,    94,    95,    96,    15,   361,   362,
+     363,    26,   197,    21,   459,    23,    24,    25,    26,   197,
+     363,   197,    30,   212,   159,    33,   440,   285,     1,    37,
+      -1,    -1,    40,    -1,    42,    -1,    -1,     0,    -1,    -1,
+     393,   394,     5,    51,    -1,    -1,    54,    55,    -1,   402,
+      -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,
+      23,    24,    25,    26,    -1,    -1,    -1,    30,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    42,
+      -1,     0,    -1,    -1,    92,    -1,     5,   440,    51,    -1,
+      -1,    54,    55,    -1,    -1,    -1,    15,    -1,    -1,    -1,
+      -1,    -1,    21,   456,    23,    24,    25,    26,    -1,    -1,
+      -1,    30,    -1,    -1,    33,    -1,    -1,    -1,    37,    -1,
+      -1,    40,    -1,    42,    -1,     0,    -1,    -1,    -1,    92,
+       5,    -1,    51,    -1,    -1,    54,    55,    -1,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    23,    24,
+      25,    26,    -1,    -1,    -1,    30,    13,    -1,    33,    -1,
+      -1,    -1,    37,    20,    -1,    40,    -1,    42,    25,     0,
+      -1,    -1,    -1,    92,     5,    -1,    51,    -1,    -1,    54,
+      55,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      21,    -1,    23,    24,    25,    26,    53,    -1,    -1,    30,
+      13,    -1,    33,    60,    61,    -1,    37,    20,    -1,    40,
+      -1,    42,    25,    -1,    71,    -1,    -1,    92,    -1,    -1,
+      51,    -1,    -1,    54,    55,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    92,    93,    94,    -1,    96,
+      53,    -1,    -1,    -1,    -1,    -1,   103,    60,    61,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    -1,
+      -1,    92,    -1,    -1,    -1,    -1,    13,    -1,    -1,    -1,
+      -1,    -1,    -1,    20,    -1,    -1,    -1,    -1,    25,    92,
+      93,    94,     3,    96,     5,     6,    -1,     8,    -1,    10,
+     103,    -1,    -1,    14,    15,    -1,    -1,    18,    19,    -1,
+      21,    -1,    23,    24,    25,    26,    53,    -1,    -1,    30,
+      -1,    -1,    33,    60,    61,    -1,    37,    -1,    -1,    40,
+      -1,    42,    -1,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      -1,    88,    89,    90,    91,    92,    93,    94,     5,    96,
+      -1,    -1,     9,    -1,   101,    -1,    -1,    -1,    15,    16,
+      17,    -1,    -1,    -1,    21,    -1,    23,    24,    25,    26,
+      -1,    92,    -1,    30,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    -1,    -1,    40,    -1,    42,    -1,    -1,    -1,    -1,
+       5,    -1,    -1,    -1,    51,    -1,    11,    54,    55,    -1,
+      15,    16,    17,    -1,    -1,    -1,    21,    -1,    23,    24,
+      25,    26,    -1,    -1,    -1,    30,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    -1,    -1,    40,    -1,    42,    -1,    -1,
+      -1,    -1,     5,    -1,    -1,    92,    51,    -1,    -1,    54,
+      55,    -1,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,
+      23,    24,    25,    26,    -1,    28,    29,    30,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    42,
+      -1,    -1,    -1,    -1,     5,    -1,    -1,    92,    51,    -1,
+      -1,    54,    55,    -1,    15,    16,    17,    -1,    -1,    -1,
+      21,    -1,    23,    24,    25,    26,    -1,     5,    -1,    30,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    15,    -1,    40,
+      -1,    42,    -1,    21,    -1,    23,    24,    25,    26,    92,
+      51,    -1,    30,    54,    55,    33,    -1,    -1,    -1,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    -1,    -1,     5,
+      -1,    -1,    -1,    51,    -1,    -1,    54,    55,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    21,    -1,    23,    24,    25,
+      26,    92,     5,    -1,    30,    -1,    -1,    33,    -1,    -1,
+      36,    37,    15,    -1,    40,    -1,    42,    -1,    21,    -1,
+      23,    24,    25,    26,    92,    51,    -1,    30,    54,    55,
+      33,    -1,    -1,    -1,    37,    -1,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,     5,    -1,    -1,    -1,    51,    -1,
+      -1,    54,    55,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      21,    -1,    23,    24,    25,    26,    92,     5,    -1,    30,
+      -1,    32,    33,    -1,    -1,    -1,    37,    15,    -1,    40,
+      -1,    42,    -1,    21,    -1,    23,    24,    25,    26,    92,
+      51,    29,    30,    54,    55,    33,    -1,    -1,    -1,    37,
+      -1,    -1,    40,    13,    42,    -1,    -1,    -1,    -1,     5,
+      20,    -1,    -1,    51,    -1,    25,    54,    55,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    21,    -1,    23,    24,    25,
+      26,    92,    -1,    13,    30,    -1,    -1,    33,    -1,    -1,
+      20,    37,    -1,    53,    40,    25,    42,    -1,    -1,    -1,
+      60,    61,    -1,    13,    92,    51,    -1,    -1,    54,    55,
+      20,    71,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      60,    61,    92,    93,    94,    -1,    96,    -1,    -1,    99,
+      13,    71,    -1,    53,    -1,    -1,    92,    20,    -1,    -1,
+      60,    61,    25,    13,    -1,    65,    -1,    67,    -1,    -1,
+      20,    71,    92,    93,    94,    25,    96,    -1,    -1,    99,
+      43,    44,    45,    46,    47,    48,    49,    -1,    -1,    -1,
+      53,    -1,    92,    93,    94,    -1,    96,    60,    61,    -1,
+      13,    -1,    52,    53,    -1,    -1,    -1,    20,    71,    -1,
+      60,    61,    25,    13,    -1,    -1,    -1,    -1,    -1,    -1,
+      20,    71,    -1,    -1,    -1,    25,    -1,    -1,    -1,    92,
+      93,    94,    95,    96,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    -1,    92,    93,    94,    -1,    96,    60,    61,    -1,
+      -1,    -1,    -1,    53,    -1,    -1,    -1,    -1,    71,    -1,
+      60,    61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,
+      93,    94,    95,    96,    64,    -1,    66,    -1,    -1,    -1,
+      70,    71,    92,    93,    94,    -1,    96,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     3,     5,     6,     8,    10,    14,    15,    18,    19,
+      21,    23,    24,    25,    26,    30,    33,    37,    40,    42,
+      51,    54,    55,    56,    92,   106,   107,   111,   112,   114,
+     117,   134,   135,   136,   138,   139,   140,   141,   142,   144,
+     145,   146,   147,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   159,   160,   167,   181,    92,   180,   181,    88,
+      89,    90,    91,   158,   181,    13,    20,    53,    60,    61,
+      71,    93,    94,    96,   157,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   181,
+      98,   120,   181,     0,    95,    95,   158,   158,   158,   158,
+     168,   168,   181,   168,     0,   161,    52,   168,     0,     0,
+      42,    57,    58,    59,     0,   111,     0,     0,   112,     0,
+     112,     0,   112,     0,     0,     0,     0,     0,     0,     0,
+     168,     0,   181,   168,   181,     0,    50,     0,    87,    98,
+     125,   126,   104,   101,   158,   168,   168,   181,    98,   101,
+     158,   175,   175,   175,   168,    96,    65,    67,   168,    63,
+      64,    66,    70,    71,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    62,    72,    73,    74,    75,    76,
+      68,    69,    96,   101,    96,    98,   115,    99,   181,    96,
+      27,    31,     4,    38,   143,   108,   112,   162,   168,    43,
+      44,    45,    46,    47,    48,    49,   163,   164,   165,    93,
+      95,   181,   108,    28,   137,   108,   108,   168,    98,   181,
+      98,   168,    99,   168,     0,   127,    92,   168,   101,     4,
+      98,   168,   103,   168,    97,   168,   169,   169,     7,    95,
+     170,   172,   172,   172,   172,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   173,   173,   173,   173,   173,
+     173,   174,   174,   168,   103,   168,   128,   129,   103,   168,
+      12,   121,   122,   118,    97,     0,   112,   168,    31,   181,
+      41,   112,    95,   163,   164,   165,   168,   181,    88,    89,
+      90,    91,   166,    96,    29,   137,     0,   112,    36,    39,
+      22,    99,    98,    99,    87,    99,    95,   131,   168,   181,
+     102,   168,   181,   168,    99,   102,   102,   100,   168,     7,
+      97,   102,   102,    97,   130,   131,    99,    99,     0,    12,
+     181,    96,   108,    34,    98,     0,   166,    96,    98,    97,
+       0,   108,     0,     0,   168,   168,    99,   168,    13,    95,
+      98,   181,    87,    96,    98,   168,   102,    99,    98,   168,
+     168,   100,   109,   110,    98,    12,   123,   124,   181,    32,
+     168,    99,   128,    99,    29,   168,   168,   168,   101,   148,
+     168,    96,    98,   168,   128,    99,   168,    99,   103,   168,
+     100,   131,     9,    16,    17,   112,   113,   132,   133,   113,
+      99,    97,   100,    98,     0,    31,    35,    31,    97,     0,
+     168,   168,    99,   100,   128,    99,    97,   103,    99,    99,
+     168,   116,   181,   181,     0,    12,   181,    99,   168,    22,
+     102,   168,    97,    97,   100,     0,     0,    98,    87,    98,
+     109,    98,    31,   168,    98,   168,    99,   168,    99,   168,
+      11,    99,    99,    97,     0,     0,    87,    99,   119,    98,
+     181,     0,     0,   148,    98,    99,    99,     0,     0
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   105,   106,   107,   107,   108,   108,   110,   109,   109,
+     111,   111,   111,   111,   111,   111,   111,   111,   112,   112,
+     112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
+     112,   112,   112,   112,   113,   113,   113,   115,   116,   114,
+     118,   119,   117,   120,   120,   121,   121,   121,   122,   122,
+     122,   123,   123,   123,   124,   124,   124,   124,   124,   126,
+     125,   127,   127,   128,   129,   128,   130,   130,   131,   131,
+     131,   131,   132,   132,   133,   133,   133,   133,   134,   134,
+     135,   135,   135,   135,   136,   137,   137,   138,   138,   139,
+     139,   140,   140,   141,   141,   142,   142,   143,   143,   144,
+     145,   145,   145,   145,   145,   145,   145,   146,   146,   146,
+     146,   146,   147,   147,   148,   148,   148,   149,   149,   149,
+     149,   150,   150,   150,   150,   150,   150,   150,   151,   151,
+     152,   152,   153,   153,   154,   154,   154,   154,   155,   155,
+     156,   156,   157,   157,   158,   158,   158,   158,   159,   159,
+     161,   160,   162,   162,   162,   162,   162,   162,   162,   162,
+     162,   163,   163,   164,   165,   165,   165,   165,   166,   166,
+     166,   166,   167,   167,   168,   168,   168,   169,   169,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
+     171,   171,   171,   171,   171,   172,   172,   172,   172,   172,
+     172,   172,   173,   173,   173,   174,   174,   174,   174,   175,
+     175,   175,   175,   175,   175,   175,   175,   175,   175,   176,
+     176,   176,   176,   176,   177,   177,   178,   178,   178,   178,
+     178,   179,   179,   180,   181
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     2,     1,     2,     0,     2,     2,
+       1,     2,     2,     2,     2,     1,     1,     2,     0,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     1,
+       1,     1,     1,     3,     1,     1,     1,     0,     0,     9,
+       0,     0,    12,     0,     2,     1,     2,     1,     0,     2,
+       4,     1,     3,     1,     0,     1,     3,     3,     5,     0,
+       2,     0,     2,     0,     0,     2,     1,     3,     1,     4,
+       3,     1,     3,     5,     5,     6,     9,     9,     2,     4,
+       2,     3,     5,     4,     3,     2,     5,     4,     7,     2,
+       5,     7,     9,     2,     5,     4,     7,     0,     1,     5,
+       3,     6,     5,     7,     7,    10,     8,     3,     3,     6,
+       7,     5,     5,     6,     0,     1,     3,     3,     5,     4,
+       6,     3,     3,     3,     4,     3,     3,     5,     2,     2,
+       3,     5,     1,     2,     6,     6,     7,     9,     1,     2,
+       1,     2,     1,     2,     1,     1,     1,     1,     1,     2,
+       0,     3,     0,     2,     2,     2,     3,     2,     5,     4,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     3,     3,     3,     1,     3,     1,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     1,
+       3,     3,     3,     3,     1,     3,     3,     3,     3,     3,
+       3,     1,     3,     3,     1,     2,     2,     2,     1,     1,
+       1,     1,     1,     3,     1,     4,     8,    10,     4,     4,
+       7,     4,     7,     7,     1,     2,     1,     1,     4,     4,
+       1,     4,     4,     3,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, scanner, env, yyroot, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, scanner, env, yyroot); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (env);
+  YY_USE (yyroot);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, scanner, env, yyroot);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), scanner, env, yyroot);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, scanner, env, yyroot); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (env);
+  YY_USE (yyroot);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
+    }
+
+  if (yychar <= T_END_OF_STATEMENT)
+    {
+      yychar = T_END_OF_STATEMENT;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* start: toplevel_block  */
+#line 131 "src/parser.y"
+                                                        { yyroot = yyvsp[0].node; }
+#line 1957 "generated/parser.cpp"
+    break;
+
+  case 3: /* toplevel_block: toplevel_statement  */
+#line 134 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBlock>( (yyloc), env ); yyval.node->add_child( yyvsp[0].node ); }
+#line 1963 "generated/parser.cpp"
+    break;
+
+  case 4: /* toplevel_block: toplevel_block toplevel_statement  */
+#line 135 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 1969 "generated/parser.cpp"
+    break;
+
+  case 5: /* block: statement  */
+#line 138 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBlock>( (yyloc), env ); yyval.node->add_child( yyvsp[0].node ); }
+#line 1975 "generated/parser.cpp"
+    break;
+
+  case 6: /* block: block statement  */
+#line 139 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 1981 "generated/parser.cpp"
+    break;
+
+  case 7: /* @1: %empty  */
+#line 142 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeBlock>( (yyloc), env ); env->set_subroutine_body( yyval.node ); }
+#line 1987 "generated/parser.cpp"
+    break;
+
+  case 8: /* subroutine_block: @1 subroutine_statement  */
+#line 143 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 1993 "generated/parser.cpp"
+    break;
+
+  case 9: /* subroutine_block: subroutine_block subroutine_statement  */
+#line 144 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 1999 "generated/parser.cpp"
+    break;
+
+  case 10: /* toplevel_statement: statement  */
+#line 147 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2005 "generated/parser.cpp"
+    break;
+
+  case 11: /* toplevel_statement: pragma_stmt T_END_OF_STATEMENT  */
+#line 148 "src/parser.y"
+                                                        { yyval.node = nullptr; }
+#line 2011 "generated/parser.cpp"
+    break;
+
+  case 12: /* toplevel_statement: map_stmt T_END_OF_STATEMENT  */
+#line 149 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; }
+#line 2017 "generated/parser.cpp"
+    break;
+
+  case 13: /* toplevel_statement: def_stmt T_END_OF_STATEMENT  */
+#line 150 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; }
+#line 2023 "generated/parser.cpp"
+    break;
+
+  case 14: /* toplevel_statement: import_stmt T_END_OF_STATEMENT  */
+#line 151 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; }
+#line 2029 "generated/parser.cpp"
+    break;
+
+  case 18: /* statement: %empty  */
+#line 157 "src/parser.y"
+                                                            { yyval.node = nullptr; }
+#line 2035 "generated/parser.cpp"
+    break;
+
+  case 19: /* statement: dim_stmt T_END_OF_STATEMENT  */
+#line 158 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2041 "generated/parser.cpp"
+    break;
+
+  case 20: /* statement: assign_stmt T_END_OF_STATEMENT  */
+#line 159 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2047 "generated/parser.cpp"
+    break;
+
+  case 21: /* statement: poke_stmt T_END_OF_STATEMENT  */
+#line 160 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2053 "generated/parser.cpp"
+    break;
+
+  case 22: /* statement: block_stmt T_END_OF_STATEMENT  */
+#line 161 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2059 "generated/parser.cpp"
+    break;
+
+  case 23: /* statement: print_stmt T_END_OF_STATEMENT  */
+#line 162 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2065 "generated/parser.cpp"
+    break;
+
+  case 24: /* statement: sleep_stmt T_END_OF_STATEMENT  */
+#line 163 "src/parser.y"
+                                                            { yyval.node = yyvsp[-1].node; }
+#line 2071 "generated/parser.cpp"
+    break;
+
+  case 25: /* statement: T_EXIT T_END_OF_STATEMENT  */
+#line 164 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeBreak>( (yylsp[-1]), env, T_EXIT ); }
+#line 2077 "generated/parser.cpp"
+    break;
+
+  case 26: /* statement: T_BREAK T_END_OF_STATEMENT  */
+#line 165 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeBreak>( (yylsp[-1]), env, T_BREAK ); }
+#line 2083 "generated/parser.cpp"
+    break;
+
+  case 27: /* statement: T_QUIT T_END_OF_STATEMENT  */
+#line 166 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeBreak>( (yylsp[-1]), env, T_QUIT ); }
+#line 2089 "generated/parser.cpp"
+    break;
+
+  case 28: /* statement: if_block  */
+#line 167 "src/parser.y"
+                                                            { yyval.node = yyvsp[0].node; }
+#line 2095 "generated/parser.cpp"
+    break;
+
+  case 29: /* statement: while_block  */
+#line 168 "src/parser.y"
+                                                            { yyval.node = yyvsp[0].node; }
+#line 2101 "generated/parser.cpp"
+    break;
+
+  case 30: /* statement: for_block  */
+#line 169 "src/parser.y"
+                                                            { yyval.node = yyvsp[0].node; }
+#line 2107 "generated/parser.cpp"
+    break;
+
+  case 31: /* statement: every_block  */
+#line 170 "src/parser.y"
+                                                            { yyval.node = yyvsp[0].node; }
+#line 2113 "generated/parser.cpp"
+    break;
+
+  case 32: /* statement: guard_block  */
+#line 171 "src/parser.y"
+                                                            { yyval.node = yyvsp[0].node; }
+#line 2119 "generated/parser.cpp"
+    break;
+
+  case 33: /* statement: plain_identifier proc_args T_END_OF_STATEMENT  */
+#line 172 "src/parser.y"
+                                                            { yyval.node = env->get_procedure( (yylsp[-2]), yyvsp[-2].value, yyvsp[-1].arglist ); if( !yyval.node ) throw ASTExceptionSyntaxError( (yylsp[-2]) ); }
+#line 2125 "generated/parser.cpp"
+    break;
+
+  case 34: /* subroutine_statement: statement  */
+#line 175 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2131 "generated/parser.cpp"
+    break;
+
+  case 35: /* subroutine_statement: global_stmt  */
+#line 176 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2137 "generated/parser.cpp"
+    break;
+
+  case 36: /* subroutine_statement: static_stmt  */
+#line 177 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2143 "generated/parser.cpp"
+    break;
+
+  case 37: /* $@2: %empty  */
+#line 185 "src/parser.y"
+                                                        { env->enter_subroutine_context( (yylsp[-1]), yyvsp[0].value, Environment::PROCEDURE ); }
+#line 2149 "generated/parser.cpp"
+    break;
+
+  case 38: /* $@3: %empty  */
+#line 188 "src/parser.y"
+                                                        { env->commit_subroutine_context(); }
+#line 2155 "generated/parser.cpp"
+    break;
+
+  case 39: /* proc_def: T_DEFPROC plain_identifier $@2 proc_arg_decl T_END_OF_STATEMENT subroutine_block T_ENDPROC $@3 T_END_OF_STATEMENT  */
+#line 189 "src/parser.y"
+                                                        { yyval.node = nullptr; }
+#line 2161 "generated/parser.cpp"
+    break;
+
+  case 40: /* $@4: %empty  */
+#line 192 "src/parser.y"
+                                                        { env->enter_subroutine_context( (yylsp[-2]), yyvsp[0].value, yyvsp[-1].token ? Environment::ARRAYFUNC : Environment::FUNCTION ); }
+#line 2167 "generated/parser.cpp"
+    break;
+
+  case 41: /* $@5: %empty  */
+#line 195 "src/parser.y"
+                                                        { env->commit_subroutine_context(); }
+#line 2173 "generated/parser.cpp"
+    break;
+
+  case 42: /* func_def: T_DEFFUNC arrayfunc_def plain_identifier $@4 '(' func_arg_decl ')' T_END_OF_STATEMENT subroutine_block T_ENDFUNC $@5 T_END_OF_STATEMENT  */
+#line 196 "src/parser.y"
+                                                        { yyval.node = nullptr; }
+#line 2179 "generated/parser.cpp"
+    break;
+
+  case 43: /* arrayfunc_def: %empty  */
+#line 199 "src/parser.y"
+                                                        { yyval.token = 0; }
+#line 2185 "generated/parser.cpp"
+    break;
+
+  case 44: /* arrayfunc_def: '[' ']'  */
+#line 200 "src/parser.y"
+                                                        { yyval.token = 1; }
+#line 2191 "generated/parser.cpp"
+    break;
+
+  case 46: /* proc_arg_decl: proc_arg_list T_ELLIPSIS  */
+#line 204 "src/parser.y"
+                                                        { env->set_subroutine_varargs(); }
+#line 2197 "generated/parser.cpp"
+    break;
+
+  case 47: /* proc_arg_decl: T_ELLIPSIS  */
+#line 205 "src/parser.y"
+                                                        { env->set_subroutine_varargs(); }
+#line 2203 "generated/parser.cpp"
+    break;
+
+  case 49: /* proc_arg_list: proc_arg_list plain_identifier  */
+#line 209 "src/parser.y"
+                                                        { env->set_subroutine_param( yyvsp[0].value ); }
+#line 2209 "generated/parser.cpp"
+    break;
+
+  case 50: /* proc_arg_list: proc_arg_list plain_identifier '[' ']'  */
+#line 210 "src/parser.y"
+                                                        { env->set_subroutine_param( yyvsp[-2].value, true ); }
+#line 2215 "generated/parser.cpp"
+    break;
+
+  case 52: /* func_arg_decl: func_arg_list ',' T_ELLIPSIS  */
+#line 214 "src/parser.y"
+                                                        { env->set_subroutine_varargs(); }
+#line 2221 "generated/parser.cpp"
+    break;
+
+  case 53: /* func_arg_decl: T_ELLIPSIS  */
+#line 215 "src/parser.y"
+                                                        { env->set_subroutine_varargs(); }
+#line 2227 "generated/parser.cpp"
+    break;
+
+  case 55: /* func_arg_list: plain_identifier  */
+#line 219 "src/parser.y"
+                                                            { env->set_subroutine_param( yyvsp[0].value ); }
+#line 2233 "generated/parser.cpp"
+    break;
+
+  case 56: /* func_arg_list: plain_identifier '[' ']'  */
+#line 220 "src/parser.y"
+                                                            { env->set_subroutine_param( yyvsp[-2].value, true ); }
+#line 2239 "generated/parser.cpp"
+    break;
+
+  case 57: /* func_arg_list: func_arg_list ',' plain_identifier  */
+#line 221 "src/parser.y"
+                                                            { env->set_subroutine_param( yyvsp[0].value ); }
+#line 2245 "generated/parser.cpp"
+    break;
+
+  case 58: /* func_arg_list: func_arg_list ',' plain_identifier '[' ']'  */
+#line 222 "src/parser.y"
+                                                            { env->set_subroutine_param( yyvsp[-2].value, true ); }
+#line 2251 "generated/parser.cpp"
+    break;
+
+  case 59: /* $@6: %empty  */
+#line 225 "src/parser.y"
+                                                        { yyarg_start(); }
+#line 2257 "generated/parser.cpp"
+    break;
+
+  case 60: /* proc_args: $@6 proc_args_items  */
+#line 226 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[0].arglist ); yyarg_end(); }
+#line 2263 "generated/parser.cpp"
+    break;
+
+  case 61: /* proc_args_items: %empty  */
+#line 229 "src/parser.y"
+                                                        { yyval.arglist.clear(); }
+#line 2269 "generated/parser.cpp"
+    break;
+
+  case 62: /* proc_args_items: proc_args_items subroutine_arg  */
+#line 230 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[-1].arglist ); yyval.arglist.push_back( yyvsp[0].arglist[0] ); }
+#line 2275 "generated/parser.cpp"
+    break;
+
+  case 63: /* func_args: %empty  */
+#line 233 "src/parser.y"
+                                                        { yyval.arglist.clear(); }
+#line 2281 "generated/parser.cpp"
+    break;
+
+  case 64: /* $@7: %empty  */
+#line 234 "src/parser.y"
+                                                        { yyarg_start(); }
+#line 2287 "generated/parser.cpp"
+    break;
+
+  case 65: /* func_args: $@7 func_args_items  */
+#line 235 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[0].arglist ); yyarg_end(); }
+#line 2293 "generated/parser.cpp"
+    break;
+
+  case 66: /* func_args_items: subroutine_arg  */
+#line 238 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[0].arglist ); }
+#line 2299 "generated/parser.cpp"
+    break;
+
+  case 67: /* func_args_items: func_args_items ',' subroutine_arg  */
+#line 239 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[-2].arglist ); yyval.arglist.push_back( yyvsp[0].arglist[0] ); }
+#line 2305 "generated/parser.cpp"
+    break;
+
+  case 68: /* subroutine_arg: T_SCONST  */
+#line 242 "src/parser.y"
+                                                        { yyval.arglist.clear(); yyval.arglist.push_back( yystringarg( (yyloc), env, yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ) ) ); }
+#line 2311 "generated/parser.cpp"
+    break;
+
+  case 69: /* subroutine_arg: plain_identifier '(' func_args ')'  */
+#line 243 "src/parser.y"
+                                                        { yyval.arglist.clear(); yyval.arglist.push_back( yyfuncarg( (yylsp[-3]), env, yyvsp[-3].value, yyvsp[-1].arglist ) ); }
+#line 2317 "generated/parser.cpp"
+    break;
+
+  case 70: /* subroutine_arg: plain_identifier '[' ']'  */
+#line 244 "src/parser.y"
+                                                        { yyval.arglist.clear(); yyval.arglist.push_back( make_pair( ASTNode::ptr(nullptr), yyvsp[-2].value ) ); }
+#line 2323 "generated/parser.cpp"
+    break;
+
+  case 71: /* subroutine_arg: expression  */
+#line 245 "src/parser.y"
+                                                        { yyval.arglist.clear(); yyval.arglist.push_back( make_pair( yyvsp[0].node, string("") ) ); }
+#line 2329 "generated/parser.cpp"
+    break;
+
+  case 72: /* global_stmt: T_GLOBAL plain_identifier T_END_OF_STATEMENT  */
+#line 248 "src/parser.y"
+                                                                    { if( !env->alloc_global_var( yyvsp[-1].value ) ) throw ASTExceptionNamingConflict( (yylsp[-2]), yyvsp[-1].value ); }
+#line 2335 "generated/parser.cpp"
+    break;
+
+  case 73: /* global_stmt: T_GLOBAL plain_identifier '[' ']' T_END_OF_STATEMENT  */
+#line 249 "src/parser.y"
+                                                                    { if( !env->alloc_global_array( yyvsp[-3].value ) ) throw ASTExceptionNamingConflict( (yylsp[-4]), yyvsp[-3].value ); }
+#line 2341 "generated/parser.cpp"
+    break;
+
+  case 74: /* static_stmt: T_STATIC plain_identifier T_ASSIGN expression T_END_OF_STATEMENT  */
+#line 253 "src/parser.y"
+                                                                { yyval.node = make_node<ASTNodeStatic>( (yylsp[-4]), env, yyvsp[-3].value, yyvsp[-1].node, true ); }
+#line 2347 "generated/parser.cpp"
+    break;
+
+  case 75: /* static_stmt: T_STATIC plain_identifier '[' expression ']' T_END_OF_STATEMENT  */
+#line 255 "src/parser.y"
+                                                                { yyval.node = make_node<ASTNodeStatic>( (yylsp[-5]), env, yyvsp[-4].value, yyvsp[-2].node, false ); }
+#line 2353 "generated/parser.cpp"
+    break;
+
+  case 76: /* static_stmt: T_STATIC plain_identifier '[' ']' T_ASSIGN '[' comma_list ']' T_END_OF_STATEMENT  */
+#line 257 "src/parser.y"
+                                                                { yyval.node = make_node<ASTNodeStatic>( (yylsp[-8]), env, yyvsp[-7].value ); for( auto arg: yyvsp[-2].arglist ) yyval.node->add_child( arg.first ); }
+#line 2359 "generated/parser.cpp"
+    break;
+
+  case 77: /* static_stmt: T_STATIC plain_identifier '[' ']' T_ASSIGN plain_identifier '[' ']' T_END_OF_STATEMENT  */
+#line 259 "src/parser.y"
+                                                                { yyval.node = make_node<ASTNodeStatic>( (yylsp[-8]), env, yyvsp[-7].value, yyvsp[-3].value ); }
+#line 2365 "generated/parser.cpp"
+    break;
+
+  case 78: /* drop_stmt: T_DROP plain_identifier  */
+#line 262 "src/parser.y"
+                                                        { if( !env->drop_procedure( yyvsp[0].value ) ) throw ASTExceptionNamingConflict( (yylsp[-1]), yyvsp[0].value ); }
+#line 2371 "generated/parser.cpp"
+    break;
+
+  case 79: /* drop_stmt: T_DROP plain_identifier '(' ')'  */
+#line 263 "src/parser.y"
+                                                        { if( !env->drop_function( yyvsp[-2].value ) ) throw ASTExceptionNamingConflict( (yylsp[-3]), yyvsp[-2].value ); }
+#line 2377 "generated/parser.cpp"
+    break;
+
+  case 80: /* if_block: if_def statement  */
+#line 271 "src/parser.y"
+                                                                        { yyval.node = make_node<ASTNodeIf>( (yyloc), yyvsp[-1].node, yyvsp[0].node ); }
+#line 2383 "generated/parser.cpp"
+    break;
+
+  case 81: /* if_block: if_def statement else_def  */
+#line 272 "src/parser.y"
+                                                                        { yyval.node = make_node<ASTNodeIf>( (yyloc), yyvsp[-2].node, yyvsp[-1].node, yyvsp[0].node ); }
+#line 2389 "generated/parser.cpp"
+    break;
+
+  case 82: /* if_block: if_def T_END_OF_STATEMENT block T_ENDIF T_END_OF_STATEMENT  */
+#line 273 "src/parser.y"
+                                                                        { yyval.node = make_node<ASTNodeIf>( (yyloc), yyvsp[-4].node, yyvsp[-2].node ); }
+#line 2395 "generated/parser.cpp"
+    break;
+
+  case 83: /* if_block: if_def T_END_OF_STATEMENT block else_def  */
+#line 274 "src/parser.y"
+                                                                        { yyval.node = make_node<ASTNodeIf>( (yyloc), yyvsp[-3].node, yyvsp[-1].node, yyvsp[0].node ); }
+#line 2401 "generated/parser.cpp"
+    break;
+
+  case 84: /* if_def: T_IF expression T_THEN  */
+#line 277 "src/parser.y"
+                                                                        { yyval.node = yyvsp[-1].node; }
+#line 2407 "generated/parser.cpp"
+    break;
+
+  case 85: /* else_def: T_ELSE statement  */
+#line 280 "src/parser.y"
+                                                                        { yyval.node = yyvsp[0].node; }
+#line 2413 "generated/parser.cpp"
+    break;
+
+  case 86: /* else_def: T_ELSE T_END_OF_STATEMENT block T_ENDIF T_END_OF_STATEMENT  */
+#line 281 "src/parser.y"
+                                                                        { yyval.node = yyvsp[-2].node; }
+#line 2419 "generated/parser.cpp"
+    break;
+
+  case 87: /* while_block: T_WHILE expression T_DO statement  */
+#line 284 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeWhile>( (yyloc), env, yyvsp[-2].node, yyvsp[0].node ); }
+#line 2425 "generated/parser.cpp"
+    break;
+
+  case 88: /* while_block: T_WHILE expression T_DO T_END_OF_STATEMENT block T_ENDWHILE T_END_OF_STATEMENT  */
+#line 287 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeWhile>( (yyloc), env, yyvsp[-5].node, yyvsp[-2].node ); }
+#line 2431 "generated/parser.cpp"
+    break;
+
+  case 89: /* for_block: for_def statement  */
+#line 290 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 2437 "generated/parser.cpp"
+    break;
+
+  case 90: /* for_block: for_def T_END_OF_STATEMENT block T_ENDFOR T_END_OF_STATEMENT  */
+#line 293 "src/parser.y"
+                                                        { yyval.node = yyvsp[-4].node; yyval.node->add_child( yyvsp[-2].node ); }
+#line 2443 "generated/parser.cpp"
+    break;
+
+  case 91: /* for_def: T_FOR plain_identifier T_FROM expression T_TO expression T_DO  */
+#line 296 "src/parser.y"
+                                                                                            { yyval.node = make_node<ASTNodeFor>( (yyloc), env, make_node<ASTNodeAssign>( (yylsp[-5]), env, yyvsp[-5].value, yyvsp[-3].node ), yyvsp[-1].node ); }
+#line 2449 "generated/parser.cpp"
+    break;
+
+  case 92: /* for_def: T_FOR plain_identifier T_FROM expression T_TO expression T_STEP expression T_DO  */
+#line 297 "src/parser.y"
+                                                                                            { yyval.node = make_node<ASTNodeFor>( (yyloc), env, make_node<ASTNodeAssign>( (yylsp[-7]), env, yyvsp[-7].value, yyvsp[-5].node ), yyvsp[-3].node, yyvsp[-1].node ); }
+#line 2455 "generated/parser.cpp"
+    break;
+
+  case 93: /* every_block: every_def statement  */
+#line 300 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; yyval.node->add_child( yyvsp[0].node ); }
+#line 2461 "generated/parser.cpp"
+    break;
+
+  case 94: /* every_block: every_def T_END_OF_STATEMENT block T_ENDEVERY T_END_OF_STATEMENT  */
+#line 303 "src/parser.y"
+                                                        { yyval.node = yyvsp[-4].node; yyval.node->add_child( yyvsp[-2].node ); }
+#line 2467 "generated/parser.cpp"
+    break;
+
+  case 95: /* every_def: T_EVERY expression every_policy T_DO  */
+#line 306 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeEvery>( (yyloc), env, yyvsp[-2].node, yyvsp[-1].token ); }
+#line 2473 "generated/parser.cpp"
+    break;
+
+  case 96: /* every_def: T_EVERY expression every_policy plain_identifier '[' ']' T_DO  */
+#line 307 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeEvery>( (yyloc), env, yyvsp[-5].node, yyvsp[-4].token, yyvsp[-3].value ); }
+#line 2479 "generated/parser.cpp"
+    break;
+
+  case 97: /* every_policy: %empty  */
+#line 310 "src/parser.y"
+                                                        { yyval.token = ASTNodeEvery::POLICY_SKIP; }
+#line 2485 "generated/parser.cpp"
+    break;
+
+  case 98: /* every_policy: T_CATCHUP  */
+#line 311 "src/parser.y"
+                                                        { yyval.token = ASTNodeEvery::POLICY_CATCH_UP; }
+#line 2491 "generated/parser.cpp"
+    break;
+
+  case 99: /* guard_block: T_GUARD T_END_OF_STATEMENT block T_ENDGUARD T_END_OF_STATEMENT  */
+#line 316 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeGuard>( (yyloc), yyvsp[-2].node ); }
+#line 2497 "generated/parser.cpp"
+    break;
+
+  case 100: /* assign_stmt: plain_identifier T_ASSIGN expression  */
+#line 324 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeAssign>( (yyloc), env, yyvsp[-2].value, yyvsp[0].node ); }
+#line 2503 "generated/parser.cpp"
+    break;
+
+  case 101: /* assign_stmt: plain_identifier '[' expression ']' T_ASSIGN expression  */
+#line 326 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeAssign>( (yyloc), env, yyvsp[-5].value, yyvsp[-3].node, yyvsp[0].node ); }
+#line 2509 "generated/parser.cpp"
+    break;
+
+  case 102: /* assign_stmt: plain_identifier '[' ']' T_ASSIGN T_SCONST  */
+#line 327 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeString>( (yyloc), env, yyvsp[-4].value, yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ) ); }
+#line 2515 "generated/parser.cpp"
+    break;
+
+  case 103: /* assign_stmt: plain_identifier '[' ']' T_ASSIGN plain_identifier '[' ']'  */
+#line 329 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeAssign>( (yyloc), env, yyvsp[-6].value, yyvsp[-2].value ); }
+#line 2521 "generated/parser.cpp"
+    break;
+
+  case 104: /* assign_stmt: plain_identifier '[' ']' T_ASSIGN '[' comma_list ']'  */
+#line 331 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeAssign>( (yyloc), env, yyvsp[-6].value ); for( auto arg: yyvsp[-1].arglist ) yyval.node->add_child( arg.first ); }
+#line 2527 "generated/parser.cpp"
+    break;
+
+  case 105: /* assign_stmt: plain_identifier '[' ']' T_ASSIGN T_ARGS '{' expression '}' '[' ']'  */
+#line 333 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeAssignArg>( (yyloc), env, yyvsp[-9].value, yyvsp[-3].node ); }
+#line 2533 "generated/parser.cpp"
+    break;
+
+  case 106: /* assign_stmt: plain_identifier '[' ']' T_ASSIGN plain_identifier '(' func_args ')'  */
+#line 335 "src/parser.y"
+                                                            { yyval.node = env->get_arrayfunc( (yylsp[-7]), yyvsp[-3].value, yyvsp[-7].value, yyvsp[-1].arglist ); if( !yyval.node ) throw ASTExceptionSyntaxError( (yylsp[-7]) ); }
+#line 2539 "generated/parser.cpp"
+    break;
+
+  case 107: /* def_stmt: T_DEF plain_identifier expression  */
+#line 338 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeDef>( (yyloc), env, yyvsp[-1].value, yyvsp[0].node ); }
+#line 2545 "generated/parser.cpp"
+    break;
+
+  case 108: /* def_stmt: T_DEF struct_identifier expression  */
+#line 339 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeDef>( (yyloc), env, yyvsp[-1].value, yyvsp[0].node ); }
+#line 2551 "generated/parser.cpp"
+    break;
+
+  case 109: /* def_stmt: T_DEF struct_identifier '{' expression '}' expression  */
+#line 340 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeDef>( (yyloc), env, yyvsp[-4].value, yyvsp[-2].node, yyvsp[0].node, env->get_default_size() ); }
+#line 2557 "generated/parser.cpp"
+    break;
+
+  case 110: /* def_stmt: T_DEF struct_identifier size_suffix '{' expression '}' expression  */
+#line 341 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeDef>( (yyloc), env, yyvsp[-5].value, yyvsp[-2].node, yyvsp[0].node, yyvsp[-4].token ); }
+#line 2563 "generated/parser.cpp"
+    break;
+
+  case 111: /* def_stmt: T_DEF plain_identifier expression T_FROM plain_identifier  */
+#line 342 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodeDef>( (yyloc), env, yyvsp[-3].value, yyvsp[-2].node, yyvsp[0].value ); }
+#line 2569 "generated/parser.cpp"
+    break;
+
+  case 112: /* dim_stmt: T_DIM plain_identifier '[' expression ']'  */
+#line 345 "src/parser.y"
+                                                                     { yyval.node = make_node<ASTNodeDim>( (yyloc), env, yyvsp[-3].value, yyvsp[-1].node ); }
+#line 2575 "generated/parser.cpp"
+    break;
+
+  case 113: /* dim_stmt: T_DIM size_suffix plain_identifier '[' expression ']'  */
+#line 346 "src/parser.y"
+                                                                     { yyval.node = make_node<ASTNodeDim>( (yyloc), env, yyvsp[-3].value, yyvsp[-1].node, yyvsp[-4].token ); }
+#line 2581 "generated/parser.cpp"
+    break;
+
+  case 114: /* comma_list: %empty  */
+#line 349 "src/parser.y"
+                                                        { yyval.arglist.clear(); }
+#line 2587 "generated/parser.cpp"
+    break;
+
+  case 115: /* comma_list: expression  */
+#line 350 "src/parser.y"
+                                                        { yyval.arglist.clear(); yyval.arglist.push_back( make_pair( yyvsp[0].node, string("") ) ); }
+#line 2593 "generated/parser.cpp"
+    break;
+
+  case 116: /* comma_list: comma_list ',' expression  */
+#line 351 "src/parser.y"
+                                                        { yyval.arglist = std::move( yyvsp[-2].arglist ); yyval.arglist.push_back( make_pair( yyvsp[0].node, string("") ) ); }
+#line 2599 "generated/parser.cpp"
+    break;
+
+  case 117: /* map_stmt: T_MAP expression expression  */
+#line 359 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMap>( (yyloc), env, yyvsp[-1].node, yyvsp[0].node ); }
+#line 2605 "generated/parser.cpp"
+    break;
+
+  case 118: /* map_stmt: T_MAP expression expression T_AT expression  */
+#line 360 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMap>( (yyloc), env, yyvsp[-3].node, yyvsp[0].node, yyvsp[-2].node ); }
+#line 2611 "generated/parser.cpp"
+    break;
+
+  case 119: /* map_stmt: T_MAP expression expression T_SCONST  */
+#line 361 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMap>( (yyloc), env, yyvsp[-2].node, yyvsp[-1].node, yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ) ); }
+#line 2617 "generated/parser.cpp"
+    break;
+
+  case 120: /* map_stmt: T_MAP expression expression T_SCONST T_AT expression  */
+#line 363 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMap>( (yyloc), env, yyvsp[-4].node, yyvsp[0].node, yyvsp[-3].node, yyvsp[-2].value.substr( 1, yyvsp[-2].value.length() - 2 ) ); }
+#line 2623 "generated/parser.cpp"
+    break;
+
+  case 121: /* pragma_stmt: T_PRAGMA T_PRINT print_array  */
+#line 366 "src/parser.y"
+                                                        { env->set_default_modifier( yyvsp[0].token ); }
+#line 2629 "generated/parser.cpp"
+    break;
+
+  case 122: /* pragma_stmt: T_PRAGMA T_PRINT print_float  */
+#line 367 "src/parser.y"
+                                                        { env->set_default_modifier( yyvsp[0].token | ASTNodePrint::MOD_64BIT ); }
+#line 2635 "generated/parser.cpp"
+    break;
+
+  case 123: /* pragma_stmt: T_PRAGMA T_PRINT print_format  */
+#line 368 "src/parser.y"
+                                                        { env->set_default_modifier( yyvsp[0].token | ASTNodePrint::MOD_WORDSIZE ); }
+#line 2641 "generated/parser.cpp"
+    break;
+
+  case 124: /* pragma_stmt: T_PRAGMA T_PRINT print_format print_size  */
+#line 369 "src/parser.y"
+                                                        { env->set_default_modifier( yyvsp[-1].token | yyvsp[0].token ); }
+#line 2647 "generated/parser.cpp"
+    break;
+
+  case 125: /* pragma_stmt: T_PRAGMA T_WORDSIZE T_CONSTANT  */
+#line 370 "src/parser.y"
+                                                        { if( !env->set_default_size( env->parse_int( yyvsp[0].value ) ) ) throw ASTExceptionSyntaxError( (yylsp[0]) ); }
+#line 2653 "generated/parser.cpp"
+    break;
+
+  case 126: /* pragma_stmt: T_PRAGMA T_LOADPATH T_SCONST  */
+#line 371 "src/parser.y"
+                                                        { string path = yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ); if( !env->add_include_path( path ) ) throw ASTExceptionFileNotFound( (yylsp[0]), path.c_str() ); }
+#line 2659 "generated/parser.cpp"
+    break;
+
+  case 127: /* pragma_stmt: T_PRAGMA T_MEMOIZE plain_identifier '(' ')'  */
+#line 372 "src/parser.y"
+                                                            { if( !env->memoize_function( (yylsp[-2]), yyvsp[-2].value ) ) throw ASTExceptionNamingConflict( (yylsp[-2]), yyvsp[-2].value ); }
+#line 2665 "generated/parser.cpp"
+    break;
+
+  case 128: /* import_stmt: T_IMPORT T_SCONST  */
+#line 375 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeImport>( (yyloc), env, yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ), true ); }
+#line 2671 "generated/parser.cpp"
+    break;
+
+  case 129: /* import_stmt: T_RUN T_SCONST  */
+#line 376 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeImport>( (yyloc), env, yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ), false ); }
+#line 2677 "generated/parser.cpp"
+    break;
+
+  case 130: /* poke_stmt: poke_token expression expression  */
+#line 379 "src/parser.y"
+                                                                    { yyval.node = make_node<ASTNodePoke>( (yyloc), env, yyvsp[-1].node, yyvsp[0].node, yyvsp[-2].token ); }
+#line 2683 "generated/parser.cpp"
+    break;
+
+  case 131: /* poke_stmt: poke_token expression expression T_MASK expression  */
+#line 380 "src/parser.y"
+                                                                    { yyval.node = make_node<ASTNodePoke>( (yyloc), env, yyvsp[-3].node, yyvsp[-2].node, yyvsp[0].node, yyvsp[-4].token ); }
+#line 2689 "generated/parser.cpp"
+    break;
+
+  case 132: /* poke_token: T_POKE  */
+#line 383 "src/parser.y"
+                                                        { yyval.token = env->get_default_size(); }
+#line 2695 "generated/parser.cpp"
+    break;
+
+  case 133: /* poke_token: T_POKE size_suffix  */
+#line 384 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2701 "generated/parser.cpp"
+    break;
+
+  case 134: /* block_stmt: peekblock_token plain_identifier '[' ']' expression expression  */
+#line 387 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodePeekBlock>( (yyloc), env, yyvsp[-4].value, yyvsp[-1].node, yyvsp[0].node, yyvsp[-5].token ); }
+#line 2707 "generated/parser.cpp"
+    break;
+
+  case 135: /* block_stmt: pokeblock_token expression plain_identifier '[' ']' expression  */
+#line 388 "src/parser.y"
+                                                                                { yyval.node = make_node<ASTNodePokeBlock>( (yyloc), env, yyvsp[-4].node, yyvsp[-3].value, yyvsp[0].node, yyvsp[-5].token ); }
+#line 2713 "generated/parser.cpp"
+    break;
+
+  case 136: /* block_stmt: memfind_token plain_identifier '[' ']' expression expression expression  */
+#line 390 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMemFind>( (yyloc), env, yyvsp[-5].value, yyvsp[-2].node, yyvsp[-1].node, yyvsp[0].node, nullptr, yyvsp[-6].token ); }
+#line 2719 "generated/parser.cpp"
+    break;
+
+  case 137: /* block_stmt: memfind_token plain_identifier '[' ']' expression expression expression T_MASK expression  */
+#line 392 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMemFind>( (yyloc), env, yyvsp[-7].value, yyvsp[-4].node, yyvsp[-3].node, yyvsp[-2].node, yyvsp[0].node, yyvsp[-8].token ); }
+#line 2725 "generated/parser.cpp"
+    break;
+
+  case 138: /* peekblock_token: T_PEEKBLOCK  */
+#line 395 "src/parser.y"
+                                                        { yyval.token = env->get_default_size(); }
+#line 2731 "generated/parser.cpp"
+    break;
+
+  case 139: /* peekblock_token: T_PEEKBLOCK size_suffix  */
+#line 396 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2737 "generated/parser.cpp"
+    break;
+
+  case 140: /* pokeblock_token: T_POKEBLOCK  */
+#line 399 "src/parser.y"
+                                                        { yyval.token = env->get_default_size(); }
+#line 2743 "generated/parser.cpp"
+    break;
+
+  case 141: /* pokeblock_token: T_POKEBLOCK size_suffix  */
+#line 400 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2749 "generated/parser.cpp"
+    break;
+
+  case 142: /* memfind_token: T_MEMFIND  */
+#line 403 "src/parser.y"
+                                                        { yyval.token = env->get_default_size(); }
+#line 2755 "generated/parser.cpp"
+    break;
+
+  case 143: /* memfind_token: T_MEMFIND size_suffix  */
+#line 404 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2761 "generated/parser.cpp"
+    break;
+
+  case 144: /* size_suffix: T_8BIT  */
+#line 407 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2767 "generated/parser.cpp"
+    break;
+
+  case 145: /* size_suffix: T_16BIT  */
+#line 408 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2773 "generated/parser.cpp"
+    break;
+
+  case 146: /* size_suffix: T_32BIT  */
+#line 409 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2779 "generated/parser.cpp"
+    break;
+
+  case 147: /* size_suffix: T_64BIT  */
+#line 410 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 2785 "generated/parser.cpp"
+    break;
+
+  case 148: /* print_stmt: print_stmt_endl  */
+#line 413 "src/parser.y"
+                                                        { yyval.node = printnode; }
+#line 2791 "generated/parser.cpp"
+    break;
+
+  case 149: /* print_stmt: print_stmt_endl T_NOENDL  */
+#line 414 "src/parser.y"
+                                                        { yyval.node = printnode; printnode->set_endl( false ); }
+#line 2797 "generated/parser.cpp"
+    break;
+
+  case 150: /* $@8: %empty  */
+#line 417 "src/parser.y"
+                                                        { printnode = make_node<ASTNodePrint>( (yyloc), env ); yyarg_start(); }
+#line 2803 "generated/parser.cpp"
+    break;
+
+  case 151: /* print_stmt_endl: T_PRINT $@8 print_args  */
+#line 418 "src/parser.y"
+                                                        { yyarg_end(); }
+#line 2809 "generated/parser.cpp"
+    break;
+
+  case 152: /* print_args: %empty  */
+#line 421 "src/parser.y"
+                                                            { yyval.token = env->get_default_modifier(); }
+#line 2815 "generated/parser.cpp"
+    break;
+
+  case 153: /* print_args: print_args print_array  */
+#line 422 "src/parser.y"
+                                                            { yyval.token = (yyvsp[-1].token & ~ASTNodePrint::MOD_ARRAYMASK) | yyvsp[0].token; }
+#line 2821 "generated/parser.cpp"
+    break;
+
+  case 154: /* print_args: print_args print_float  */
+#line 423 "src/parser.y"
+                                                            { yyval.token = (yyvsp[-1].token & ~ASTNodePrint::MOD_TYPESIZEMASK) | yyvsp[0].token | ASTNodePrint::MOD_64BIT; }
+#line 2827 "generated/parser.cpp"
+    break;
+
+  case 155: /* print_args: print_args print_format  */
+#line 424 "src/parser.y"
+                                                            { yyval.token = (yyvsp[-1].token & ~ASTNodePrint::MOD_TYPESIZEMASK) | yyvsp[0].token | ASTNodePrint::MOD_WORDSIZE; }
+#line 2833 "generated/parser.cpp"
+    break;
+
+  case 156: /* print_args: print_args print_format print_size  */
+#line 425 "src/parser.y"
+                                                            { yyval.token = (yyvsp[-2].token & ~ASTNodePrint::MOD_TYPESIZEMASK) | yyvsp[-1].token | yyvsp[0].token; }
+#line 2839 "generated/parser.cpp"
+    break;
+
+  case 157: /* print_args: print_args T_SCONST  */
+#line 426 "src/parser.y"
+                                                            { yyval.token = yyvsp[-1].token; printnode->add_arg( yyvsp[0].value.substr( 1, yyvsp[0].value.length() - 2 ) ); }
+#line 2845 "generated/parser.cpp"
+    break;
+
+  case 158: /* print_args: print_args plain_identifier '(' func_args ')'  */
+#line 427 "src/parser.y"
+                                                            { yyval.token = yyvsp[-4].token; printnode->add_arg( yyfuncarg( (yylsp[-3]), env, yyvsp[-3].value, yyvsp[-1].arglist ).first, yyval.token ); }
+#line 2851 "generated/parser.cpp"
+    break;
+
+  case 159: /* print_args: print_args plain_identifier '[' ']'  */
+#line 428 "src/parser.y"
+                                                            { yyval.token = yyvsp[-3].token; printnode->add_arg( make_node<ASTNodeArray>( yylloc, env, yyvsp[-2].value ), yyval.token ); }
+#line 2857 "generated/parser.cpp"
+    break;
+
+  case 160: /* print_args: print_args expression  */
+#line 429 "src/parser.y"
+                                                            { yyval.token = yyvsp[-1].token; printnode->add_arg( yyvsp[0].node, yyval.token & ~ASTNodePrint::MOD_ARRAYMASK ); }
+#line 2863 "generated/parser.cpp"
+    break;
+
+  case 161: /* print_array: T_ARRAY  */
+#line 432 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_ARRAY; }
+#line 2869 "generated/parser.cpp"
+    break;
+
+  case 162: /* print_array: T_STRING  */
+#line 433 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_STRING; }
+#line 2875 "generated/parser.cpp"
+    break;
+
+  case 163: /* print_float: T_FLOAT  */
+#line 435 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_FLOAT; }
+#line 2881 "generated/parser.cpp"
+    break;
+
+  case 164: /* print_format: T_DEC  */
+#line 438 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_DEC; }
+#line 2887 "generated/parser.cpp"
+    break;
+
+  case 165: /* print_format: T_HEX  */
+#line 439 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_HEX; }
+#line 2893 "generated/parser.cpp"
+    break;
+
+  case 166: /* print_format: T_BIN  */
+#line 440 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_BIN; }
+#line 2899 "generated/parser.cpp"
+    break;
+
+  case 167: /* print_format: T_NEG  */
+#line 441 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_NEG; }
+#line 2905 "generated/parser.cpp"
+    break;
+
+  case 168: /* print_size: T_8BIT  */
+#line 444 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_8BIT; }
+#line 2911 "generated/parser.cpp"
+    break;
+
+  case 169: /* print_size: T_16BIT  */
+#line 445 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_16BIT; }
+#line 2917 "generated/parser.cpp"
+    break;
+
+  case 170: /* print_size: T_32BIT  */
+#line 446 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_32BIT; }
+#line 2923 "generated/parser.cpp"
+    break;
+
+  case 171: /* print_size: T_64BIT  */
+#line 447 "src/parser.y"
+                                                        { yyval.token = ASTNodePrint::MOD_64BIT; }
+#line 2929 "generated/parser.cpp"
+    break;
+
+  case 172: /* sleep_stmt: T_SLEEP expression  */
+#line 450 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeSleep>( (yyloc), env, yyvsp[0].node, false ); }
+#line 2935 "generated/parser.cpp"
+    break;
+
+  case 173: /* sleep_stmt: T_SLEEP T_UNTIL expression  */
+#line 451 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeSleep>( (yyloc), env, yyvsp[0].node, true ); }
+#line 2941 "generated/parser.cpp"
+    break;
+
+  case 174: /* expression: expression T_LOG_OR and_expr  */
+#line 459 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2947 "generated/parser.cpp"
+    break;
+
+  case 175: /* expression: expression T_LOG_XOR and_expr  */
+#line 460 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2953 "generated/parser.cpp"
+    break;
+
+  case 176: /* expression: and_expr  */
+#line 461 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2959 "generated/parser.cpp"
+    break;
+
+  case 177: /* and_expr: and_expr T_LOG_AND comp_expr  */
+#line 464 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2965 "generated/parser.cpp"
+    break;
+
+  case 178: /* and_expr: comp_expr  */
+#line 465 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 2971 "generated/parser.cpp"
+    break;
+
+  case 179: /* comp_expr: add_expr T_LT add_expr  */
+#line 468 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2977 "generated/parser.cpp"
+    break;
+
+  case 180: /* comp_expr: add_expr T_GT add_expr  */
+#line 469 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2983 "generated/parser.cpp"
+    break;
+
+  case 181: /* comp_expr: add_expr T_LE add_expr  */
+#line 470 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2989 "generated/parser.cpp"
+    break;
+
+  case 182: /* comp_expr: add_expr T_GE add_expr  */
+#line 471 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 2995 "generated/parser.cpp"
+    break;
+
+  case 183: /* comp_expr: add_expr T_EQ add_expr  */
+#line 472 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3001 "generated/parser.cpp"
+    break;
+
+  case 184: /* comp_expr: add_expr T_NE add_expr  */
+#line 473 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3007 "generated/parser.cpp"
+    break;
+
+  case 185: /* comp_expr: add_expr T_SLT add_expr  */
+#line 474 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3013 "generated/parser.cpp"
+    break;
+
+  case 186: /* comp_expr: add_expr T_SGT add_expr  */
+#line 475 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3019 "generated/parser.cpp"
+    break;
+
+  case 187: /* comp_expr: add_expr T_SLE add_expr  */
+#line 476 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3025 "generated/parser.cpp"
+    break;
+
+  case 188: /* comp_expr: add_expr T_SGE add_expr  */
+#line 477 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3031 "generated/parser.cpp"
+    break;
+
+  case 189: /* comp_expr: add_expr  */
+#line 478 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3037 "generated/parser.cpp"
+    break;
+
+  case 190: /* add_expr: add_expr T_PLUS mul_expr  */
+#line 481 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3043 "generated/parser.cpp"
+    break;
+
+  case 191: /* add_expr: add_expr T_MINUS mul_expr  */
+#line 482 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3049 "generated/parser.cpp"
+    break;
+
+  case 192: /* add_expr: add_expr T_BIT_OR mul_expr  */
+#line 483 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3055 "generated/parser.cpp"
+    break;
+
+  case 193: /* add_expr: add_expr T_BIT_XOR mul_expr  */
+#line 484 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3061 "generated/parser.cpp"
+    break;
+
+  case 194: /* add_expr: mul_expr  */
+#line 485 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3067 "generated/parser.cpp"
+    break;
+
+  case 195: /* mul_expr: mul_expr T_MUL shift_expr  */
+#line 488 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3073 "generated/parser.cpp"
+    break;
+
+  case 196: /* mul_expr: mul_expr T_DIV shift_expr  */
+#line 489 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3079 "generated/parser.cpp"
+    break;
+
+  case 197: /* mul_expr: mul_expr T_MOD shift_expr  */
+#line 490 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3085 "generated/parser.cpp"
+    break;
+
+  case 198: /* mul_expr: mul_expr T_SDIV shift_expr  */
+#line 491 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3091 "generated/parser.cpp"
+    break;
+
+  case 199: /* mul_expr: mul_expr T_SMOD shift_expr  */
+#line 492 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3097 "generated/parser.cpp"
+    break;
+
+  case 200: /* mul_expr: mul_expr T_BIT_AND shift_expr  */
+#line 493 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3103 "generated/parser.cpp"
+    break;
+
+  case 201: /* mul_expr: shift_expr  */
+#line 494 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3109 "generated/parser.cpp"
+    break;
+
+  case 202: /* shift_expr: shift_expr T_LSHIFT unary_expr  */
+#line 497 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3115 "generated/parser.cpp"
+    break;
+
+  case 203: /* shift_expr: shift_expr T_RSHIFT unary_expr  */
+#line 498 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeBinaryOperator>( (yyloc), yyvsp[-2].node, yyvsp[0].node, yyvsp[-1].token ); }
+#line 3121 "generated/parser.cpp"
+    break;
+
+  case 204: /* shift_expr: unary_expr  */
+#line 499 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3127 "generated/parser.cpp"
+    break;
+
+  case 205: /* unary_expr: T_MINUS atomic_expr  */
+#line 502 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeUnaryOperator>( (yyloc), yyvsp[0].node, yyvsp[-1].token ); }
+#line 3133 "generated/parser.cpp"
+    break;
+
+  case 206: /* unary_expr: T_BIT_NOT atomic_expr  */
+#line 503 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeUnaryOperator>( (yyloc), yyvsp[0].node, yyvsp[-1].token ); }
+#line 3139 "generated/parser.cpp"
+    break;
+
+  case 207: /* unary_expr: T_LOG_NOT atomic_expr  */
+#line 504 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeUnaryOperator>( (yyloc), yyvsp[0].node, yyvsp[-1].token ); }
+#line 3145 "generated/parser.cpp"
+    break;
+
+  case 208: /* unary_expr: atomic_expr  */
+#line 505 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3151 "generated/parser.cpp"
+    break;
+
+  case 209: /* atomic_expr: T_CONSTANT  */
+#line 508 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeConstant>( (yyloc), yyvsp[0].value ); }
+#line 3157 "generated/parser.cpp"
+    break;
+
+  case 210: /* atomic_expr: T_FCONST  */
+#line 509 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeConstant>( (yyloc), yyvsp[0].value, true ); }
+#line 3163 "generated/parser.cpp"
+    break;
+
+  case 211: /* atomic_expr: T_NOW  */
+#line 510 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeSleep>( (yyloc), env ); }
+#line 3169 "generated/parser.cpp"
+    break;
+
+  case 212: /* atomic_expr: var_identifier  */
+#line 511 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3175 "generated/parser.cpp"
+    break;
+
+  case 213: /* atomic_expr: '(' expression ')'  */
+#line 512 "src/parser.y"
+                                                        { yyval.node = yyvsp[-1].node; }
+#line 3181 "generated/parser.cpp"
+    break;
+
+  case 214: /* atomic_expr: args_expr  */
+#line 513 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3187 "generated/parser.cpp"
+    break;
+
+  case 215: /* atomic_expr: peek_token '(' expression ')'  */
+#line 514 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodePeek>( (yyloc), env, yyvsp[-1].node, yyvsp[-3].token ); }
+#line 3193 "generated/parser.cpp"
+    break;
+
+  case 216: /* atomic_expr: memfind_token '(' expression ',' expression ',' expression ')'  */
+#line 516 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMemFind>( (yyloc), env, yyvsp[-5].node, yyvsp[-3].node, yyvsp[-1].node, nullptr, yyvsp[-7].token ); }
+#line 3199 "generated/parser.cpp"
+    break;
+
+  case 217: /* atomic_expr: memfind_token '(' expression ',' expression ',' expression ',' expression ')'  */
+#line 518 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeMemFind>( (yyloc), env, yyvsp[-7].node, yyvsp[-5].node, yyvsp[-3].node, yyvsp[-1].node, yyvsp[-9].token ); }
+#line 3205 "generated/parser.cpp"
+    break;
+
+  case 218: /* atomic_expr: plain_identifier '(' func_args ')'  */
+#line 519 "src/parser.y"
+                                                        { yyval.node = env->get_function( (yylsp[-3]), yyvsp[-3].value, yyvsp[-1].arglist ); if( !yyval.node ) throw ASTExceptionSyntaxError( (yylsp[-3]) ); }
+#line 3211 "generated/parser.cpp"
+    break;
+
+  case 219: /* args_expr: T_ARGS '{' '?' '}'  */
+#line 522 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeArg>( (yyloc), env ); }
+#line 3217 "generated/parser.cpp"
+    break;
+
+  case 220: /* args_expr: T_ARGS '{' expression '}' '[' ']' '?'  */
+#line 523 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeArg>( (yyloc), env, yyvsp[-4].node, ASTNodeArg::GET_TYPE ); }
+#line 3223 "generated/parser.cpp"
+    break;
+
+  case 221: /* args_expr: T_ARGS '{' expression '}'  */
+#line 524 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeArg>( (yyloc), env, yyvsp[-1].node, ASTNodeArg::GET_VAR ); }
+#line 3229 "generated/parser.cpp"
+    break;
+
+  case 222: /* args_expr: T_ARGS '{' expression '}' '[' '?' ']'  */
+#line 525 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeArg>( (yyloc), env, yyvsp[-4].node, ASTNodeArg::GET_ARRAYSIZE ); }
+#line 3235 "generated/parser.cpp"
+    break;
+
+  case 223: /* args_expr: T_ARGS '{' expression '}' '[' expression ']'  */
+#line 526 "src/parser.y"
+                                                            { yyval.node = make_node<ASTNodeArg>( (yyloc), env, yyvsp[-4].node, yyvsp[-1].node ); }
+#line 3241 "generated/parser.cpp"
+    break;
+
+  case 224: /* peek_token: T_PEEK  */
+#line 529 "src/parser.y"
+                                                        { yyval.token = env->get_default_size(); }
+#line 3247 "generated/parser.cpp"
+    break;
+
+  case 225: /* peek_token: T_PEEK size_suffix  */
+#line 530 "src/parser.y"
+                                                        { yyval.token = yyvsp[0].token; }
+#line 3253 "generated/parser.cpp"
+    break;
+
+  case 226: /* var_identifier: plain_identifier  */
+#line 533 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeVar>( (yyloc), env, yyvsp[0].value ); }
+#line 3259 "generated/parser.cpp"
+    break;
+
+  case 227: /* var_identifier: struct_identifier  */
+#line 534 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeVar>( (yyloc), env, yyvsp[0].value ); }
+#line 3265 "generated/parser.cpp"
+    break;
+
+  case 228: /* var_identifier: struct_identifier '{' '?' '}'  */
+#line 535 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeRange>( (yyloc), env, yyvsp[-3].value ); }
+#line 3271 "generated/parser.cpp"
+    break;
+
+  case 229: /* var_identifier: struct_identifier '{' expression '}'  */
+#line 536 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeRange>( (yyloc), env, yyvsp[-3].value, yyvsp[-1].node ); }
+#line 3277 "generated/parser.cpp"
+    break;
+
+  case 230: /* var_identifier: array_identifier  */
+#line 537 "src/parser.y"
+                                                        { yyval.node = yyvsp[0].node; }
+#line 3283 "generated/parser.cpp"
+    break;
+
+  case 231: /* array_identifier: plain_identifier '[' '?' ']'  */
+#line 540 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeArray>( (yyloc), env, yyvsp[-3].value ); }
+#line 3289 "generated/parser.cpp"
+    break;
+
+  case 232: /* array_identifier: plain_identifier '[' expression ']'  */
+#line 541 "src/parser.y"
+                                                        { yyval.node = make_node<ASTNodeArray>( (yyloc), env, yyvsp[-3].value, yyvsp[-1].node ); }
+#line 3295 "generated/parser.cpp"
+    break;
+
+  case 233: /* struct_identifier: T_IDENTIFIER '.' T_IDENTIFIER  */
+#line 544 "src/parser.y"
+                                                        { yyval.value = yyvsp[-2].value + '.' + yyvsp[0].value; }
+#line 3301 "generated/parser.cpp"
+    break;
+
+
+#line 3305 "generated/parser.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, scanner, env, yyroot, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= T_END_OF_STATEMENT)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == T_END_OF_STATEMENT)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, scanner, env, yyroot);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, scanner, env, yyroot);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, scanner, env, yyroot, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, scanner, env, yyroot);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, scanner, env, yyroot);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 549 "src/parser.y"
+
@@ -0,0 +1,181 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_GENERATED_PARSER_H_INCLUDED
+# define YY_YY_GENERATED_PARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    T_END_OF_STATEMENT = 0,        /* T_END_OF_STATEMENT  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    T_DEF = 258,                   /* T_DEF  */
+    T_FROM = 259,                  /* T_FROM  */
+    T_DIM = 260,                   /* T_DIM  */
+    T_MAP = 261,                   /* T_MAP  */
+    T_AT = 262,                    /* T_AT  */
+    T_DEFPROC = 263,               /* T_DEFPROC  */
+    T_ENDPROC = 264,               /* T_ENDPROC  */
+    T_DEFFUNC = 265,               /* T_DEFFUNC  */
+    T_ENDFUNC = 266,               /* T_ENDFUNC  */
+    T_ELLIPSIS = 267,              /* T_ELLIPSIS  */
+    T_ARGS = 268,                  /* T_ARGS  */
+    T_DROP = 269,                  /* T_DROP  */
+    T_EXIT = 270,                  /* T_EXIT  */
+    T_GLOBAL = 271,                /* T_GLOBAL  */
+    T_STATIC = 272,                /* T_STATIC  */
+    T_IMPORT = 273,                /* T_IMPORT  */
+    T_RUN = 274,                   /* T_RUN  */
+    T_PEEK = 275,                  /* T_PEEK  */
+    T_POKE = 276,                  /* T_POKE  */
+    T_MASK = 277,                  /* T_MASK  */
+    T_PEEKBLOCK = 278,             /* T_PEEKBLOCK  */
+    T_POKEBLOCK = 279,             /* T_POKEBLOCK  */
+    T_MEMFIND = 280,               /* T_MEMFIND  */
+    T_IF = 281,                    /* T_IF  */
+    T_THEN = 282,                  /* T_THEN  */
+    T_ELSE = 283,                  /* T_ELSE  */
+    T_ENDIF = 284,                 /* T_ENDIF  */
+    T_WHILE = 285,                 /* T_WHILE  */
+    T_DO = 286,                    /* T_DO  */
+    T_ENDWHILE = 287,              /* T_ENDWHILE  */
+    T_FOR = 288,                   /* T_FOR  */
+    T_TO = 289,                    /* T_TO  */
+    T_STEP = 290,                  /* T_STEP  */
+    T_ENDFOR = 291,                /* T_ENDFOR  */
+    T_EVERY = 292,                 /* T_EVERY  */
+    T_CATCHUP = 293,               /* T_CATCHUP  */
+    T_ENDEVERY = 294,              /* T_ENDEVERY  */
+    T_GUARD = 295,                 /* T_GUARD  */
+    T_ENDGUARD = 296,              /* T_ENDGUARD  */
+    T_PRINT = 297,                 /* T_PRINT  */
+    T_DEC = 298,                   /* T_DEC  */
+    T_HEX = 299,                   /* T_HEX  */
+    T_BIN = 300,                   /* T_BIN  */
+    T_NEG = 301,                   /* T_NEG  */
+    T_FLOAT = 302,                 /* T_FLOAT  */
+    T_ARRAY = 303,                 /* T_ARRAY  */
+    T_STRING = 304,                /* T_STRING  */
+    T_NOENDL = 305,                /* T_NOENDL  */
+    T_SLEEP = 306,                 /* T_SLEEP  */
+    T_UNTIL = 307,                 /* T_UNTIL  */
+    T_NOW = 308,                   /* T_NOW  */
+    T_BREAK = 309,                 /* T_BREAK  */
+    T_QUIT = 310,                  /* T_QUIT  */
+    T_PRAGMA = 311,                /* T_PRAGMA  */
+    T_WORDSIZE = 312,              /* T_WORDSIZE  */
+    T_LOADPATH = 313,              /* T_LOADPATH  */
+    T_MEMOIZE = 314,               /* T_MEMOIZE  */
+    T_BIT_NOT = 315,               /* T_BIT_NOT  */
+    T_LOG_NOT = 316,               /* T_LOG_NOT  */
+    T_BIT_AND = 317,               /* T_BIT_AND  */
+    T_LOG_AND = 318,               /* T_LOG_AND  */
+    T_BIT_XOR = 319,               /* T_BIT_XOR  */
+    T_LOG_XOR = 320,               /* T_LOG_XOR  */
+    T_BIT_OR = 321,                /* T_BIT_OR  */
+    T_LOG_OR = 322,                /* T_LOG_OR  */
+    T_LSHIFT = 323,                /* T_LSHIFT  */
+    T_RSHIFT = 324,                /* T_RSHIFT  */
+    T_PLUS = 325,                  /* T_PLUS  */
+    T_MINUS = 326,                 /* T_MINUS  */
+    T_MUL = 327,                   /* T_MUL  */
+    T_DIV = 328,                   /* T_DIV  */
+    T_MOD = 329,                   /* T_MOD  */
+    T_SDIV = 330,                  /* T_SDIV  */
+    T_SMOD = 331,                  /* T_SMOD  */
+    T_LT = 332,                    /* T_LT  */
+    T_GT = 333,                    /* T_GT  */
+    T_LE = 334,                    /* T_LE  */
+    T_GE = 335,                    /* T_GE  */
+    T_EQ = 336,                    /* T_EQ  */
+    T_NE = 337,                    /* T_NE  */
+    T_SLT = 338,                   /* T_SLT  */
+    T_SGT = 339,                   /* T_SGT  */
+    T_SLE = 340,                   /* T_SLE  */
+    T_SGE = 341,                   /* T_SGE  */
+    T_ASSIGN = 342,                /* T_ASSIGN  */
+    T_8BIT = 343,                  /* T_8BIT  */
+    T_16BIT = 344,                 /* T_16BIT  */
+    T_32BIT = 345,                 /* T_32BIT  */
+    T_64BIT = 346,                 /* T_64BIT  */
+    T_IDENTIFIER = 347,            /* T_IDENTIFIER  */
+    T_CONSTANT = 348,              /* T_CONSTANT  */
+    T_FCONST = 349,                /* T_FCONST  */
+    T_SCONST = 350                 /* T_SCONST  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+typedef  yyvalue_t  YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (yyscan_t scanner, yyenv_t env, yynodeptr_t& yyroot);
+
+
+#endif /* !YY_YY_GENERATED_PARSER_H_INCLUDED  */
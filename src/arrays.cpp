@@ -37,6 +37,8 @@ using namespace std;
 //////////////////////////////////////////////////////////////////////////////
 
 ArrayManager::ArrayManager()
+ : m_Arena( 256 ),
+   m_Pool( 16384 )
 {}
 
 ArrayManager::~ArrayManager()
@@ -47,7 +49,7 @@ ArrayManager::~ArrayManager()
     release_storage();
 }
 
-ArrayManager::array* ArrayManager::alloc_global( std::string name )
+ArrayManager::array* ArrayManager::alloc_global( symbol_t name )
 {
     auto iter = m_Arrays.find( name );
 
@@ -59,7 +61,7 @@ ArrayManager::array* ArrayManager::alloc_global( std::string name )
     return iter->second;
 }
 
-ArrayManager::array* ArrayManager::alloc_delegate( std::string name, ArrayManager::array* array )
+ArrayManager::array* ArrayManager::alloc_delegate( symbol_t name, ArrayManager::array* array )
 {
     if( m_Arrays.find( name ) != m_Arrays.end() ) return nullptr;
 
@@ -68,7 +70,7 @@ ArrayManager::array* ArrayManager::alloc_delegate( std::string name, ArrayManage
     return ref;
 }
 
-ArrayManager::refarray* ArrayManager::alloc_ref( std::string name )
+ArrayManager::refarray* ArrayManager::alloc_ref( symbol_t name )
 {
     if( m_Arrays.find( name ) != m_Arrays.end() ) return nullptr;
 
@@ -77,23 +79,23 @@ ArrayManager::refarray* ArrayManager::alloc_ref( std::string name )
     return ref;
 }
 
-ArrayManager::array* ArrayManager::alloc_local( std::string name )
+ArrayManager::array* ArrayManager::alloc_local( symbol_t name )
 {
     auto iter = m_Arrays.find( name );
 
     if( iter == m_Arrays.end() ) {
-        ArrayManager::array* array = new ArrayManager::localarray( m_Storage, m_StorageSize++ );
+        ArrayManager::array* array = new ArrayManager::localarray( m_Storage, m_Pool, m_StorageSize++ );
         iter = m_Arrays.insert( make_pair( name, array ) ).first;
     }
 
     return iter->second;
 }
 
-void ArrayManager::get_autocompletion( std::set< std::string >& completions, std::string prefix )
+void ArrayManager::get_autocompletion( std::set< std::string >& completions, const std::string& prefix )
 {
-    for( auto iter = m_Arrays.lower_bound( prefix ); iter != m_Arrays.end(); iter++ ) {
-        if( iter->first.substr( 0, prefix.length() ) != prefix ) break;
-        completions.insert( iter->first );
+    for( auto value: m_Arrays ) {
+        const string& name = SymbolTable::get_name( value.first );
+        if( name.compare( 0, prefix.length(), prefix ) == 0 ) completions.insert( name );
     }
 }
 
@@ -130,6 +132,60 @@ uint64_t* ArrayManager::array::realloc( uint64_t* old_array, uint64_t old_size,
     return new_array;
 }
 
+void ArrayManager::array::resize_data( data_t* data, uint64_t size )
+{
+    const uint64_t words = get_words( size, data->width );
+
+    if( size == 0 ) {
+        if( data->array && !data->pooled ) delete[] data->array;
+        data->array = nullptr;
+        data->size = 0;
+        data->capacity = 0;
+    }
+    else if( data->pooled || words > data->capacity || words < data->capacity / 4 ) {
+        const uint64_t capacity = get_capacity( data, words );
+        uint64_t* array = realloc( data->array, std::min( get_words( data->size, data->width ), words ), capacity );
+        if( data->array && !data->pooled ) delete[] data->array;
+        data->array = array;
+        data->capacity = capacity;
+        clear_elements( data, data->size, size );
+        data->size = size;
+    }
+    else {
+        clear_elements( data, data->size, size );
+        data->size = size;
+    }
+
+    data->pooled = false;
+}
+
+void ArrayManager::array::clear_elements( data_t* data, uint64_t from, uint64_t to )
+{
+    // a shrunk array of packed elements keeps stale elements in its last word
+    if( to > from ) memset( reinterpret_cast< uint8_t* >( data->array ) + from * data->width, 0, ( to - from ) * data->width );
+}
+
+void ArrayManager::array::set_width( unsigned width )
+{
+    data_t* data = get_data();
+    if( data->width == width ) return;
+
+    data_t converted;
+    converted.width = width;
+
+    if( data->size > 0 ) {
+        converted.array = new(std::nothrow) uint64_t[ get_words( data->size, width ) ]();
+        if( !converted.array ) throw ASTExceptionOutOfMemory( data->size );
+        converted.size = data->size;
+        converted.capacity = get_words( data->size, width );
+
+        for( uint64_t i = 0; i < data->size; i++ ) set_element( &converted, i, get_element( data, i ) );
+    }
+
+    if( data->array && !data->pooled ) delete[] data->array;
+    *data = converted;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ArrayManager::globalarray implementation
@@ -143,13 +199,13 @@ ArrayManager::globalarray::~globalarray()
 uint64_t ArrayManager::globalarray::get( uint64_t index ) const
 {
     if( index >= m_Data.size ) throw ASTExceptionOutOfBounds( index, m_Data.size );
-    return m_Data.array[ index ];
+    return get_element( &m_Data, index );
 }
 
 void ArrayManager::globalarray::set( uint64_t index, uint64_t value )
 {
     if( index >= m_Data.size ) throw ASTExceptionOutOfBounds( index, m_Data.size );
-    m_Data.array[ index ] = value;
+    set_element( &m_Data, index, value );
 }
 
 uint64_t ArrayManager::globalarray::get_size() const
@@ -159,17 +215,7 @@ uint64_t ArrayManager::globalarray::get_size() const
 
 void ArrayManager::globalarray::resize( uint64_t size )
 {
-    if( size == 0 ) {
-        if( m_Data.array ) delete[] m_Data.array;
-        m_Data.array = nullptr;
-        m_Data.size = 0;
-    }
-    else {
-        uint64_t* array = realloc( m_Data.array, m_Data.size, size );
-        if( m_Data.array ) delete[] m_Data.array;
-        m_Data.array = array;
-        m_Data.size = size;
-    }
+    resize_data( &m_Data, size );
 }
 
 ArrayManager::array::data_t* ArrayManager::globalarray::get_data()
@@ -182,8 +228,9 @@ ArrayManager::array::data_t* ArrayManager::globalarray::get_data()
 // class ArrayManager::localarray implementation
 //////////////////////////////////////////////////////////////////////////////
 
-ArrayManager::localarray::localarray( ArrayManager::arraydata_t*& storage, size_t offset )
+ArrayManager::localarray::localarray( ArrayManager::arraydata_t*& storage, FrameArena< uint64_t >& pool, size_t offset )
  : m_Storage( storage ),
+   m_Pool( pool ),
    m_Offset( offset )
 {}
 
@@ -197,7 +244,7 @@ uint64_t ArrayManager::localarray::get( uint64_t index ) const
     ArrayManager::arraydata_t& arraydata = m_Storage[ m_Offset ];
 
     if( index >= arraydata.size ) throw ASTExceptionOutOfBounds( index, arraydata.size );
-    return arraydata.array[ index ];
+    return get_element( &arraydata, index );
 }
 
 void ArrayManager::localarray::set( uint64_t index, uint64_t value )
@@ -205,7 +252,7 @@ void ArrayManager::localarray::set( uint64_t index, uint64_t value )
     ArrayManager::arraydata_t& arraydata = m_Storage[ m_Offset ];
 
     if( index >= arraydata.size ) throw ASTExceptionOutOfBounds( index, arraydata.size );
-    arraydata.array[ index ] = value;
+    set_element( &arraydata, index, value );
 }
 
 uint64_t ArrayManager::localarray::get_size() const
@@ -217,18 +264,35 @@ uint64_t ArrayManager::localarray::get_size() const
 
 void ArrayManager::localarray::resize( uint64_t size )
 {
+    // small arrays take their elements from the pool of the current frame,
+    // which is released as a whole when the frame is popped
+    const uint64_t MAX_POOLED_SIZE = 1024;
+
     ArrayManager::arraydata_t& arraydata = m_Storage[ m_Offset ];
 
-    if( size == 0 ) {
-        if( arraydata.array ) delete[] arraydata.array;
-        arraydata.array = nullptr;
-        arraydata.size = 0;
+    const uint64_t old_words = get_words( arraydata.size, arraydata.width );
+    const uint64_t new_words = get_words( size, arraydata.width );
+
+    if( size == 0 || new_words > MAX_POOLED_SIZE ) resize_data( &arraydata, size );
+    else if( arraydata.pooled && new_words <= arraydata.capacity ) {
+        clear_elements( &arraydata, arraydata.size, size );
+        arraydata.size = size;
+    }
+    else if( arraydata.pooled && m_Pool.resize( arraydata.array, arraydata.capacity, new_words ) ) {
+        arraydata.capacity = new_words;
+        clear_elements( &arraydata, arraydata.size, size );
+        arraydata.size = size;
     }
     else {
-        uint64_t* array = realloc( arraydata.array, arraydata.size, size );
-        if( arraydata.array ) delete[] arraydata.array;
+        const uint64_t capacity = std::min( get_capacity( &arraydata, new_words ), MAX_POOLED_SIZE );
+        uint64_t* array = m_Pool.alloc( capacity );
+        std::copy( arraydata.array, arraydata.array + std::min( old_words, new_words ), array );
+        if( arraydata.array && !arraydata.pooled ) delete[] arraydata.array;
         arraydata.array = array;
+        arraydata.capacity = capacity;
+        clear_elements( &arraydata, arraydata.size, size );
         arraydata.size = size;
+        arraydata.pooled = true;
     }
 }
 
@@ -283,13 +347,13 @@ ArrayManager::refarray::refarray()
 uint64_t ArrayManager::refarray::get( uint64_t index ) const
 {
     if( index >= m_Data->size ) throw ASTExceptionOutOfBounds( index, m_Data->size );
-    return m_Data->array[ index ];
+    return get_element( m_Data, index );
 }
 
 void ArrayManager::refarray::set( uint64_t index, uint64_t value )
 {
     if( index >= m_Data->size ) throw ASTExceptionOutOfBounds( index, m_Data->size );
-    m_Data->array[ index ] = value;
+    set_element( m_Data, index, value );
 }
 
 uint64_t ArrayManager::refarray::get_size() const
@@ -299,17 +363,9 @@ uint64_t ArrayManager::refarray::get_size() const
 
 void ArrayManager::refarray::resize( uint64_t size )
 {
-    if( size == 0 ) {
-        if( m_Data->array ) delete[] m_Data->array;
-        m_Data->array = nullptr;
-        m_Data->size = 0;
-    }
-    else {
-        uint64_t* array = realloc( m_Data->array, m_Data->size, size );
-        if( m_Data->array ) delete[] m_Data->array;
-        m_Data->array = array;
-        m_Data->size = size;
-    }
+    // the referenced array may live in a caller's frame, so the pool of the
+    // current frame must not be used here
+    resize_data( m_Data, size );
 }
 
 ArrayManager::array::data_t* ArrayManager::refarray::get_data()
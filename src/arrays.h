@@ -26,13 +26,18 @@
 #ifndef __arrays_h__
 #define __arrays_h__
 
+#include "framearena.h"
+#include "symbols.h"
+
 #include <string>
+#include <vector>
 #include <stack>
-#include <map>
+#include <unordered_map>
 #include <set>
 #include <algorithm>
 
 #include <stdint.h>
+#include <string.h>
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -47,14 +52,16 @@ public:
     ArrayManager();
     ~ArrayManager();
 
-    ArrayManager::array* alloc_global( std::string name );
-    ArrayManager::array* alloc_delegate( std::string name, ArrayManager::array* array );
-    ArrayManager::refarray* alloc_ref( std::string name );
-    ArrayManager::array* alloc_local( std::string name );
+    ArrayManager::array* alloc_global( symbol_t name );
+    ArrayManager::array* alloc_delegate( symbol_t name, ArrayManager::array* array );
+    ArrayManager::refarray* alloc_ref( symbol_t name );
+    ArrayManager::array* alloc_local( symbol_t name );
+
+    void get_autocompletion( std::set< std::string >& completions, const std::string& prefix );
 
-    void get_autocompletion( std::set< std::string >& completions, std::string prefix );
+    ArrayManager::array* get( symbol_t name );
 
-    ArrayManager::array* get( std::string name );
+    bool has_locals() const;
 
     void push();
     void pop();
@@ -68,16 +75,31 @@ private:
 
     void release_storage();
 
-    std::map< std::string, ArrayManager::array* > m_Arrays;
+    std::unordered_map< symbol_t, ArrayManager::array* > m_Arrays;
 
+    // the elements are packed with width bytes each, array holds
+    // capacity >= get_words( size, width ) words
     typedef struct {
         uint64_t size = 0;
         uint64_t* array = nullptr;
+        uint64_t capacity = 0;
+        bool pooled = false;
+        uint8_t width = 8;
     } arraydata_t;
 
+    typedef struct {
+        arraydata_t* storage;
+        FrameArena< arraydata_t >::mark_t mark;
+        FrameArena< uint64_t >::mark_t pool_mark;
+    } frame_t;
+
     arraydata_t* m_Storage = nullptr;
     size_t m_StorageSize = 0;
-    std::stack< arraydata_t* > m_Stack;
+    FrameArena< arraydata_t > m_Arena;
+    std::vector< frame_t > m_Stack;
+
+    // elements of small local arrays, released when the frame is popped
+    FrameArena< uint64_t > m_Pool;
 };
 
 
@@ -98,6 +120,14 @@ public:
 
     virtual void resize( uint64_t size ) = 0;
 
+    // element width in bytes, changing it converts the elements
+    unsigned get_width() const;
+    void set_width( unsigned width );
+
+    // direct access to the packed elements, valid until the next resize
+    void* get_buffer();
+    const void* get_buffer() const;
+
 protected:
     typedef ArrayManager::arraydata_t data_t;
 
@@ -105,7 +135,16 @@ protected:
 
     static data_t* get_data_from_sibling( array* array );
 
+    static uint64_t get_words( uint64_t size, unsigned width );
+    static uint64_t get_capacity( const data_t* data, uint64_t words );
+
+    static uint64_t get_element( const data_t* data, uint64_t index );
+    static void set_element( data_t* data, uint64_t index, uint64_t value );
+
     static uint64_t* realloc( uint64_t* old_array, uint64_t old_size, uint64_t new_size );
+
+    static void resize_data( data_t* data, uint64_t size );
+    static void clear_elements( data_t* data, uint64_t from, uint64_t to );
 };
 
 
@@ -138,7 +177,7 @@ private:
 
 class ArrayManager::localarray final : public ArrayManager::array {
 public:
-    localarray( ArrayManager::arraydata_t*& storage, size_t offset );
+    localarray( ArrayManager::arraydata_t*& storage, FrameArena< uint64_t >& pool, size_t offset );
 
     bool is_local() const override;
 
@@ -154,6 +193,7 @@ protected:
 
 private:
     data_t*& m_Storage;
+    FrameArena< uint64_t >& m_Pool;
     size_t m_Offset;
 };
 
@@ -214,18 +254,81 @@ private:
 // class ArrayManager inline functions
 //////////////////////////////////////////////////////////////////////////////
 
-inline ArrayManager::array* ArrayManager::get( std::string name )
+inline unsigned ArrayManager::array::get_width() const
+{
+    return const_cast< array* >( this )->get_data()->width;
+}
+
+inline void* ArrayManager::array::get_buffer()
+{
+    return get_data()->array;
+}
+
+inline const void* ArrayManager::array::get_buffer() const
+{
+    return const_cast< array* >( this )->get_data()->array;
+}
+
+inline uint64_t ArrayManager::array::get_words( uint64_t size, unsigned width )
+{
+    return ( size * width + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t );
+}
+
+inline uint64_t ArrayManager::array::get_capacity( const data_t* data, uint64_t words )
+{
+    // arrays growing step by step, like strings built by strcat, get headroom
+    // so that appending is amortized
+    if( data->size == 0 || words <= data->capacity ) return words;
+    else return std::max( words, data->capacity + data->capacity / 2 );
+}
+
+inline uint64_t ArrayManager::array::get_element( const data_t* data, uint64_t index )
+{
+    if( data->width == sizeof( uint64_t ) ) return data->array[ index ];
+
+    // the narrow widths are accessed with memcpy, the storage is typed uint64_t
+    const uint8_t* element = reinterpret_cast< const uint8_t* >( data->array ) + index * data->width;
+
+    switch( data->width ) {
+    case 1: return *element;
+    case 2: { uint16_t value; memcpy( &value, element, sizeof( value ) ); return value; }
+    default: { uint32_t value; memcpy( &value, element, sizeof( value ) ); return value; }
+    }
+}
+
+inline void ArrayManager::array::set_element( data_t* data, uint64_t index, uint64_t value )
+{
+    if( data->width == sizeof( uint64_t ) ) {
+        data->array[ index ] = value;
+        return;
+    }
+
+    uint8_t* element = reinterpret_cast< uint8_t* >( data->array ) + index * data->width;
+
+    switch( data->width ) {
+    case 1: *element = (uint8_t)value; break;
+    case 2: { uint16_t narrow = (uint16_t)value; memcpy( element, &narrow, sizeof( narrow ) ); break; }
+    default: { uint32_t narrow = (uint32_t)value; memcpy( element, &narrow, sizeof( narrow ) ); break; }
+    }
+}
+
+inline ArrayManager::array* ArrayManager::get( symbol_t name )
 {
     auto iter = m_Arrays.find( name );
     if( iter == m_Arrays.end() ) return nullptr;
     else return iter->second;
 }
 
+inline bool ArrayManager::has_locals() const
+{
+    return m_StorageSize > 0;
+}
+
 inline void ArrayManager::push()
 {
     if( m_StorageSize > 0 ) {
-        m_Stack.push( m_Storage );
-        m_Storage = new arraydata_t[ m_StorageSize ];
+        m_Stack.push_back( { m_Storage, m_Arena.get_mark(), m_Pool.get_mark() } );
+        m_Storage = m_Arena.alloc( m_StorageSize );
     }
 }
 
@@ -233,8 +336,10 @@ inline void ArrayManager::pop()
 {
     if( !m_Stack.empty() ) {
         release_storage();
-        m_Storage = m_Stack.top();
-        m_Stack.pop();
+        m_Storage = m_Stack.back().storage;
+        m_Arena.release( m_Stack.back().mark );
+        m_Pool.release( m_Stack.back().pool_mark );
+        m_Stack.pop_back();
     }
 }
 
@@ -242,10 +347,8 @@ inline void ArrayManager::release_storage()
 {
     if( m_Storage ) {
         std::for_each( m_Storage, m_Storage + m_StorageSize, [] ( arraydata_t& arraydata ) {
-            if( arraydata.array ) delete[] arraydata.array;
+            if( arraydata.array && !arraydata.pooled ) delete[] arraydata.array;
         });
-        delete[] m_Storage;
-        m_Storage = nullptr;
     }
 }
 
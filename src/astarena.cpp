@@ -0,0 +1,67 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "astarena.h"
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTArena* ASTArena::s_Current = nullptr;
+
+ASTArena::ASTArena()
+{}
+
+ASTArena::~ASTArena()
+{
+    for( char* block: m_Blocks ) ::operator delete( block );
+}
+
+void ASTArena::release()
+{
+    // out of line, inlined into the allocators the compiler cannot see that
+    // nothing touches the arena after the last release
+    if( --m_RefCount == 0 ) delete this;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena::scope implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTArena::scope::scope()
+ : m_Arena( new ASTArena() ),
+   m_Previous( s_Current )
+{
+    m_Arena->acquire();
+    s_Current = m_Arena;
+}
+
+ASTArena::scope::~scope()
+{
+    s_Current = m_Previous;
+    m_Arena->release();
+}
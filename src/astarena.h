@@ -0,0 +1,273 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __astarena_h__
+#define __astarena_h__
+
+#include <vector>
+#include <new>
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena
+//////////////////////////////////////////////////////////////////////////////
+
+// Memory for the nodes of one parse result. Nodes are allocated with a
+// pointer bump, freed memory is only kept in per size free lists for reuse
+// (mostly child lists outgrown while parsing and nodes replaced by constant
+// folding). The arena is released when the parser and the last node
+// allocated from it are gone. The reference count is not thread safe, ASTs
+// are only used from the interpreter thread.
+
+class ASTArena {
+public:
+    template< typename T > class allocator;
+    class scope;
+
+    // arena of the innermost active scope, or nullptr
+    static ASTArena* get_current();
+
+    void* allocate( size_t size, size_t alignment );
+    void deallocate( void* ptr, size_t size, size_t alignment );
+
+    void acquire();
+    void release();
+
+private:
+    ASTArena();
+    ~ASTArena();
+
+    static ASTArena* s_Current;
+
+    static const size_t FREE_LIST_GRANULE = sizeof(void*);
+    static const size_t NUM_FREE_LISTS = 64;
+
+    static bool is_reusable( size_t size, size_t alignment );
+
+    void* m_FreeLists[ NUM_FREE_LISTS ] = {};
+
+    std::vector< char* > m_Blocks;
+    char* m_Top = nullptr;
+    char* m_End = nullptr;
+    size_t m_BlockSize = 1024;
+
+    size_t m_RefCount = 0;
+
+    ASTArena( const ASTArena& ) = delete;
+    ASTArena& operator=( const ASTArena& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena::allocator
+//////////////////////////////////////////////////////////////////////////////
+
+// standard allocator on top of an arena, falls back to the heap without arena
+
+template< typename T >
+class ASTArena::allocator {
+public:
+    typedef T value_type;
+
+    allocator( ASTArena* arena );
+    allocator( const allocator& other );
+    template< typename U > allocator( const allocator< U >& other );
+    ~allocator();
+
+    allocator& operator=( const allocator& other );
+
+    T* allocate( size_t n );
+    void deallocate( T* ptr, size_t n );
+
+    template< typename U > bool operator==( const allocator< U >& other ) const;
+    template< typename U > bool operator!=( const allocator< U >& other ) const;
+
+private:
+    template< typename U > friend class allocator;
+
+    ASTArena* m_Arena;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena::scope
+//////////////////////////////////////////////////////////////////////////////
+
+// makes a new arena the current one for the lifetime of the scope
+
+class ASTArena::scope {
+public:
+    scope();
+    ~scope();
+
+private:
+    ASTArena* m_Arena;
+    ASTArena* m_Previous;
+
+    scope( const scope& ) = delete;
+    scope& operator=( const scope& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline ASTArena* ASTArena::get_current()
+{
+    return s_Current;
+}
+
+inline bool ASTArena::is_reusable( size_t size, size_t alignment )
+{
+    return size > 0 && size <= NUM_FREE_LISTS * FREE_LIST_GRANULE && alignment <= FREE_LIST_GRANULE;
+}
+
+inline void* ASTArena::allocate( size_t size, size_t alignment )
+{
+    if( is_reusable( size, alignment ) ) {
+        size = (size + FREE_LIST_GRANULE - 1) & ~(FREE_LIST_GRANULE - 1);
+        alignment = FREE_LIST_GRANULE;
+
+        void*& head = m_FreeLists[ size / FREE_LIST_GRANULE - 1 ];
+        if( head ) {
+            void* ptr = head;
+            head = *(void**)ptr;
+            return ptr;
+        }
+    }
+
+    char* ptr = (char*)(((uintptr_t)m_Top + alignment - 1) & ~(uintptr_t)(alignment - 1));
+
+    if( !m_Top || ptr + size > m_End ) {
+        // blocks grow with the AST, up to 64k
+        if( m_BlockSize < 65536 ) m_BlockSize *= 2;
+
+        char* block = (char*)::operator new( size + alignment > m_BlockSize ? size + alignment : m_BlockSize );
+        m_Blocks.push_back( block );
+
+        if( size + alignment > m_BlockSize ) {
+            // oversized requests get their own block, the current one stays active
+            return (char*)(((uintptr_t)block + alignment - 1) & ~(uintptr_t)(alignment - 1));
+        }
+
+        m_Top = block;
+        m_End = block + m_BlockSize;
+        ptr = (char*)(((uintptr_t)m_Top + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    }
+
+    m_Top = ptr + size;
+    return ptr;
+}
+
+inline void ASTArena::deallocate( void* ptr, size_t size, size_t alignment )
+{
+    if( is_reusable( size, alignment ) ) {
+        void*& head = m_FreeLists[ (size + FREE_LIST_GRANULE - 1) / FREE_LIST_GRANULE - 1 ];
+        *(void**)ptr = head;
+        head = ptr;
+    }
+}
+
+inline void ASTArena::acquire()
+{
+    m_RefCount++;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTArena::allocator template functions
+//////////////////////////////////////////////////////////////////////////////
+
+template< typename T >
+inline ASTArena::allocator< T >::allocator( ASTArena* arena )
+ : m_Arena( arena )
+{
+    if( m_Arena ) m_Arena->acquire();
+}
+
+template< typename T >
+inline ASTArena::allocator< T >::allocator( const allocator& other )
+ : m_Arena( other.m_Arena )
+{
+    if( m_Arena ) m_Arena->acquire();
+}
+
+template< typename T >
+template< typename U >
+inline ASTArena::allocator< T >::allocator( const allocator< U >& other )
+ : m_Arena( other.m_Arena )
+{
+    if( m_Arena ) m_Arena->acquire();
+}
+
+template< typename T >
+inline ASTArena::allocator< T >::~allocator()
+{
+    if( m_Arena ) m_Arena->release();
+}
+
+template< typename T >
+inline ASTArena::allocator< T >& ASTArena::allocator< T >::operator=( const allocator& other )
+{
+    if( other.m_Arena ) other.m_Arena->acquire();
+    if( m_Arena ) m_Arena->release();
+    m_Arena = other.m_Arena;
+    return *this;
+}
+
+template< typename T >
+inline T* ASTArena::allocator< T >::allocate( size_t n )
+{
+    if( m_Arena ) return (T*)m_Arena->allocate( n * sizeof(T), alignof(T) );
+    else return (T*)::operator new( n * sizeof(T) );
+}
+
+template< typename T >
+inline void ASTArena::allocator< T >::deallocate( T* ptr, size_t n )
+{
+    if( m_Arena ) m_Arena->deallocate( ptr, n * sizeof(T), alignof(T) );
+    else ::operator delete( ptr );
+}
+
+template< typename T >
+template< typename U >
+inline bool ASTArena::allocator< T >::operator==( const allocator< U >& other ) const
+{
+    return m_Arena == other.m_Arena;
+}
+
+template< typename T >
+template< typename U >
+inline bool ASTArena::allocator< T >::operator!=( const allocator< U >& other ) const
+{
+    return m_Arena != other.m_Arena;
+}
+
+
+#endif // __astarena_h__
@@ -41,15 +41,15 @@ BuiltinManager::BuiltinManager( Environment* env )
  : m_Env( env )
 {}
 
-void BuiltinManager::get_autocompletion( std::set< std::string >& completions, std::string prefix )
+void BuiltinManager::get_autocompletion( std::set< std::string >& completions, const std::string& prefix )
 {
-    for( auto iter = m_Builtins.lower_bound( prefix ); iter != m_Builtins.end(); iter++ ) {
-        if( iter->first.substr( 0, prefix.length() ) != prefix ) break;
-        completions.insert( iter->first );
+    for( auto& value: m_Builtins ) {
+        const string& name = SymbolTable::get_name( value.first );
+        if( name.compare( 0, prefix.length(), prefix ) == 0 ) completions.insert( name );
     }
 }
 
-std::shared_ptr<ASTNode> BuiltinManager::get_subroutine( const yylloc_t& location, std::string name, const arglist_t& args )
+std::shared_ptr<ASTNode> BuiltinManager::get_subroutine( const yylloc_t& location, symbol_t name, const arglist_t& args )
 {
     auto iter = m_Builtins.find( name );
     if( iter == m_Builtins.end() ) return nullptr;
@@ -59,8 +59,12 @@ std::shared_ptr<ASTNode> BuiltinManager::get_subroutine( const yylloc_t& locatio
     return node->is_constant() ? node->clone_to_const() : node;
 }
 
-void BuiltinManager::register_function( std::string name, nodecreator_t creator )
+void BuiltinManager::register_function( std::string name, nodecreator_t creator, bool is_inplace )
 {
-    auto ret = m_Builtins.insert( make_pair( name, creator ) );
+    const symbol_t symbol = SymbolTable::intern( name );
+
+    auto ret = m_Builtins.insert( make_pair( symbol, creator ) );
     assert( ret.second );
+
+    if( is_inplace ) m_Inplace.insert( symbol );
 }
@@ -27,9 +27,10 @@
 #define __builtins_h__
 
 #include "mempeek_parser.h"
+#include "symbols.h"
 
 #include <string>
-#include <map>
+#include <unordered_map>
 #include <set>
 #include <vector>
 #include <functional>
@@ -47,22 +48,26 @@ class BuiltinManager {
 public:
     BuiltinManager( Environment* env );
 
-    void get_autocompletion( std::set< std::string >& completions, std::string prefix );
+    void get_autocompletion( std::set< std::string >& completions, const std::string& prefix );
 
-    bool has_subroutine( std::string name );
-    std::shared_ptr<ASTNode> get_subroutine( const yylloc_t& location, std::string name, const arglist_t& args );
+    bool has_subroutine( symbol_t name );
+    bool is_inplace( symbol_t name );
+    std::shared_ptr<ASTNode> get_subroutine( const yylloc_t& location, symbol_t name, const arglist_t& args );
 
     typedef std::function< std::shared_ptr<ASTNode>( const yylloc_t& location, Environment* env, const arglist_t& args ) > nodecreator_t;
 
-    void register_function( std::string name, nodecreator_t creator );
+    // in-place array functions may get their return array as an input, e.g.
+    // s[] := strcat( s[], t[] ), and write it without a temporary copy
+    void register_function( std::string name, nodecreator_t creator, bool is_inplace = false );
 
 private:
-    typedef std::map< std::string, nodecreator_t > builtinmap_t;
+    typedef std::unordered_map< symbol_t, nodecreator_t > builtinmap_t;
 
     Environment* m_Env;
 
     // TODO: make m_Builtins static
     builtinmap_t m_Builtins;
+    std::set< symbol_t > m_Inplace;
 };
 
 
@@ -70,11 +75,16 @@ private:
 // class BuiltinManager inline functions
 //////////////////////////////////////////////////////////////////////////////
 
-inline bool BuiltinManager::has_subroutine( std::string name )
+inline bool BuiltinManager::has_subroutine( symbol_t name )
 {
     auto iter = m_Builtins.find( name );
     return iter != m_Builtins.end();
 }
 
+inline bool BuiltinManager::is_inplace( symbol_t name )
+{
+    return m_Inplace.find( name ) != m_Inplace.end();
+}
+
 
 #endif // __builtins_h__
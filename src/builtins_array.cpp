@@ -0,0 +1,515 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "builtins.h"
+#include "mempeek_ast.h"
+#include "memscan.h"
+
+#include <algorithm>
+#include <vector>
+#include <type_traits>
+
+#include <string.h>
+
+using namespace std;
+
+namespace builtins {
+
+
+//////////////////////////////////////////////////////////////////////////////
+// kernels
+//////////////////////////////////////////////////////////////////////////////
+
+// The kernels work directly on the packed elements of an array, typed with
+// its element width. They are written as plain loops and rely on the auto
+// vectorization of the compiler (builtins_array.o is always built with -O3,
+// see the Makefile), which only uses the baseline instruction set of the
+// target, e.g. SSE2 on x86-64 without a -march option.
+
+// calls K< E >::run( data, size, args... ) with the element type of array
+template< template< typename > class K, typename... ARGS >
+static uint64_t dispatch( Environment::array* array, ARGS... args )
+{
+    void* buffer = array->get_buffer();
+    const uint64_t size = array->get_size();
+
+    switch( array->get_width() ) {
+    case 1: return K< uint8_t >::run( (uint8_t*)buffer, size, args... );
+    case 2: return K< uint16_t >::run( (uint16_t*)buffer, size, args... );
+    case 4: return K< uint32_t >::run( (uint32_t*)buffer, size, args... );
+    default: return K< uint64_t >::run( (uint64_t*)buffer, size, args... );
+    }
+}
+
+template< typename E >
+struct sum_kernel {
+    static uint64_t run( const E* data, uint64_t size )
+    {
+        uint64_t sum = 0;
+        for( uint64_t i = 0; i < size; i++ ) sum += data[i];
+        return sum;
+    }
+};
+
+template< typename E >
+struct min_kernel {
+    static uint64_t run( const E* data, uint64_t size )
+    {
+        if( size == 0 ) return ~(uint64_t)0;
+
+        E min = data[0];
+        for( uint64_t i = 1; i < size; i++ ) min = data[i] < min ? data[i] : min;
+        return min;
+    }
+};
+
+template< typename E >
+struct max_kernel {
+    static uint64_t run( const E* data, uint64_t size )
+    {
+        E max = 0;
+        for( uint64_t i = 0; i < size; i++ ) max = data[i] > max ? data[i] : max;
+        return max;
+    }
+};
+
+template< typename E >
+struct find_kernel {
+    static uint64_t run( const E* data, uint64_t size, uint64_t value )
+    {
+        // values not representable with the element width are never found
+        if( (E)value != value ) return size;
+
+        return memscan< E >( data, size, value, (E)~0 );
+    }
+};
+
+template< typename E >
+struct count_kernel {
+    static uint64_t run( const E* data, uint64_t size, uint64_t value, uint64_t mask )
+    {
+        if( (E)value != value ) return 0;
+
+        uint64_t count = 0;
+        for( uint64_t i = 0; i < size; i++ ) count += ( data[i] & (E)mask ) == (E)value;
+        return count;
+    }
+};
+
+template< typename E >
+struct fill_kernel {
+    static uint64_t run( E* data, uint64_t size, uint64_t value )
+    {
+        std::fill( data, data + size, (E)value );
+        return 0;
+    }
+};
+
+typedef enum { MAP_AND, MAP_OR, MAP_XOR, MAP_SHL, MAP_SHR } map_op_t;
+
+// result[i] = data[i] op value, the shifts are done with 64 bits and masked
+// with mask afterwards, shifting by 64 or more bits results in 0
+template< typename E >
+struct map_kernel {
+    static uint64_t run( const E* data, uint64_t size, void* result, map_op_t op, uint64_t value, uint64_t mask )
+    {
+        E* dst = (E*)result;
+
+        if( ( op == MAP_SHL || op == MAP_SHR ) && value >= 64 ) op = MAP_AND, value = 0;
+
+        switch( op ) {
+        case MAP_AND: for( uint64_t i = 0; i < size; i++ ) dst[i] = data[i] & (E)value; break;
+        case MAP_OR: for( uint64_t i = 0; i < size; i++ ) dst[i] = data[i] | (E)value; break;
+        case MAP_XOR: for( uint64_t i = 0; i < size; i++ ) dst[i] = data[i] ^ (E)value; break;
+        case MAP_SHL: for( uint64_t i = 0; i < size; i++ ) dst[i] = (E)( ( (uint64_t)data[i] << value ) & mask ); break;
+        case MAP_SHR: for( uint64_t i = 0; i < size; i++ ) dst[i] = (E)( ( (uint64_t)data[i] >> value ) & mask ); break;
+        }
+
+        return 0;
+    }
+};
+
+// the orderings are mapped to the unsigned order of keys: signed values get
+// their sign bit flipped, IEEE floating point values of the element width
+// are flipped completely if negative
+typedef enum { ORDER_UNSIGNED, ORDER_SIGNED, ORDER_FLOAT } order_t;
+
+template< typename E >
+static inline E to_key( E value, order_t order )
+{
+    const E sign = (E)1 << ( sizeof(E) * 8 - 1 );
+
+    switch( order ) {
+    case ORDER_SIGNED: return value ^ sign;
+    case ORDER_FLOAT: return ( value & sign ) ? (E)~value : (E)( value | sign );
+    default: return value;
+    }
+}
+
+template< typename E >
+static inline E from_key( E key, order_t order )
+{
+    const E sign = (E)1 << ( sizeof(E) * 8 - 1 );
+
+    switch( order ) {
+    case ORDER_SIGNED: return key ^ sign;
+    case ORDER_FLOAT: return ( key & sign ) ? (E)( key & ~sign ) : (E)~key;
+    default: return key;
+    }
+}
+
+// LSD radix sort with 8 bit digits, digits shared by all elements are skipped
+template< typename E >
+static void radix_sort( E* data, uint64_t size )
+{
+    std::vector< uint64_t > counts( sizeof(E) * 256, 0 );
+
+    for( uint64_t i = 0; i < size; i++ ) {
+        for( size_t digit = 0; digit < sizeof(E); digit++ ) counts[ digit * 256 + ( ( data[i] >> ( digit * 8 ) ) & 0xff ) ]++;
+    }
+
+    std::vector< E > buffer( size );
+    E* src = data;
+    E* dst = buffer.data();
+
+    for( size_t digit = 0; digit < sizeof(E); digit++ ) {
+        uint64_t* count = counts.data() + digit * 256;
+        if( *std::max_element( count, count + 256 ) == size ) continue;
+
+        uint64_t offset = 0;
+        for( size_t i = 0; i < 256; i++ ) {
+            const uint64_t n = count[i];
+            count[i] = offset;
+            offset += n;
+        }
+
+        for( uint64_t i = 0; i < size; i++ ) dst[ count[ ( src[i] >> ( digit * 8 ) ) & 0xff ]++ ] = src[i];
+        std::swap( src, dst );
+    }
+
+    if( src != data ) std::copy( src, src + size, data );
+}
+
+template< typename E >
+struct sort_kernel {
+    static uint64_t run( E* data, uint64_t size, order_t order )
+    {
+        // below this size std::sort is faster than the radix passes
+        const uint64_t RADIX_SORT_SIZE = 4096;
+
+        for( uint64_t i = 0; i < size; i++ ) data[i] = to_key( data[i], order );
+
+        if( size >= RADIX_SORT_SIZE || sizeof(E) == 1 ) radix_sort( data, size );
+        else std::sort( data, data + size );
+
+        for( uint64_t i = 0; i < size; i++ ) data[i] = from_key( data[i], order );
+
+        return 0;
+    }
+};
+
+// the array is not changed, the selection is done on a copy
+template< typename E >
+struct nth_kernel {
+    static uint64_t run( const E* data, uint64_t size, uint64_t n, order_t order )
+    {
+        std::vector< E > keys( size );
+        for( uint64_t i = 0; i < size; i++ ) keys[i] = to_key( data[i], order );
+
+        std::nth_element( keys.begin(), keys.begin() + n, keys.end() );
+
+        return from_key( keys[n], order );
+    }
+};
+
+// returns the index of the first element not before value
+template< typename E >
+struct search_kernel {
+    static uint64_t run( const E* data, uint64_t size, uint64_t value, order_t order )
+    {
+        // values out of the range of the element width are before or after all elements
+        typedef typename std::make_signed< E >::type S;
+
+        if( order == ORDER_UNSIGNED && (E)value != value ) return size;
+        if( order == ORDER_SIGNED && (int64_t)(S)value != (int64_t)value ) return (int64_t)value < 0 ? 0 : size;
+
+        const E key = to_key( (E)value, order );
+
+        return std::lower_bound( data, data + size, key, [order] ( E element, E key ) {
+            return to_key( element, order ) < key;
+        }) - data;
+    }
+};
+
+// gives result the element width and size of src, result may be src itself
+static void prepare_result( Environment::array* result, Environment::array* src )
+{
+    if( result->get_buffer() == src->get_buffer() && result->get_size() == src->get_size() ) return;
+
+    result->resize( 0 );
+    result->set_width( src->get_width() );
+    result->resize( src->get_size() );
+}
+
+// like prepare_result(), and copies the elements of src to result
+static void copy_result( Environment::array* result, Environment::array* src )
+{
+    if( result->get_buffer() == src->get_buffer() ) return;
+
+    prepare_result( result, src );
+    if( src->get_size() > 0 ) memcpy( result->get_buffer(), src->get_buffer(), src->get_size() * src->get_width() );
+}
+
+static ASTNode::ptr map_elements( const yylloc_t& location, Environment* env, const arglist_t& args, map_op_t op )
+{
+    // the shift functions take an optional mask as last argument
+    if( args.size() == 3 ) {
+        return make_node< ASTNodeBuiltin<3,0x03> >( location, env, args, [op] ( const ASTNodeBuiltin<3,0x03>::args_t& args ) -> uint64_t {
+            prepare_result( args[0].array, args[1].array );
+            return dispatch< map_kernel >( args[1].array, args[0].array->get_buffer(), op, args[2].value, ~(uint64_t)0 );
+        });
+    }
+    else {
+        if( op != MAP_SHL && op != MAP_SHR ) throw ASTExceptionSyntaxError( location );
+
+        return make_node< ASTNodeBuiltin<4,0x03> >( location, env, args, [op] ( const ASTNodeBuiltin<4,0x03>::args_t& args ) -> uint64_t {
+            prepare_result( args[0].array, args[1].array );
+            return dispatch< map_kernel >( args[1].array, args[0].array->get_buffer(), op, args[2].value, args[3].value );
+        });
+    }
+}
+
+static ASTNode::ptr sort( const yylloc_t& location, Environment* env, const arglist_t& args, order_t order )
+{
+    return make_node< ASTNodeBuiltin<2,0x03> >( location, env, args, [order] ( const ASTNodeBuiltin<2,0x03>::args_t& args ) -> uint64_t {
+        copy_result( args[0].array, args[1].array );
+        return dispatch< sort_kernel >( args[0].array, order );
+    });
+}
+
+static ASTNode::ptr nth( const yylloc_t& location, Environment* env, const arglist_t& args, order_t order )
+{
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [location, order] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+        const uint64_t size = args[0].array->get_size();
+        if( args[1].value >= size ) throw ASTExceptionOutOfBounds( location, args[1].value, size );
+
+        return dispatch< nth_kernel >( args[0].array, args[1].value, order );
+    });
+}
+
+static ASTNode::ptr search( const yylloc_t& location, Environment* env, const arglist_t& args, order_t order )
+{
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [order] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+        return dispatch< search_kernel >( args[0].array, args[1].value, order );
+    });
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// builtin function node creators
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNode::ptr arraysum( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+        return dispatch< sum_kernel >( args[0].array );
+    });
+}
+
+ASTNode::ptr arraymin( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+        return dispatch< min_kernel >( args[0].array );
+    });
+}
+
+ASTNode::ptr arraymax( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+        return dispatch< max_kernel >( args[0].array );
+    });
+}
+
+ASTNode::ptr arrayfind( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+        return dispatch< find_kernel >( args[0].array, args[1].value );
+    });
+}
+
+ASTNode::ptr arraycount( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    if( args.size() == 2 ) {
+        return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+            return dispatch< count_kernel >( args[0].array, args[1].value, ~(uint64_t)0 );
+        });
+    }
+    else {
+        return make_node< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
+            return dispatch< count_kernel >( args[0].array, args[1].value, args[2].value );
+        });
+    }
+}
+
+ASTNode::ptr arrayfill( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
+        args[0].array->resize( args[1].value );
+        return dispatch< fill_kernel >( args[0].array, args[2].value );
+    });
+}
+
+ASTNode::ptr arraycopy( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return make_node< ASTNodeBuiltin<4,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<4,0x03>::args_t& args ) -> uint64_t {
+        Environment::array* result = args[0].array;
+        Environment::array* src = args[1].array;
+
+        const uint64_t size = src->get_size();
+        const uint64_t pos = min( args[2].value, size );
+        const uint64_t len = min( args[3].value, size - pos );
+        const unsigned width = src->get_width();
+
+        if( result->get_buffer() == src->get_buffer() ) {
+            // copying a range of the array itself, the range is moved to the front
+            if( len > 0 ) memmove( src->get_buffer(), (uint8_t*)src->get_buffer() + pos * width, len * width );
+            result->resize( len );
+        }
+        else {
+            result->resize( 0 );
+            result->set_width( width );
+            result->resize( len );
+            if( len > 0 ) memcpy( result->get_buffer(), (uint8_t*)src->get_buffer() + pos * width, len * width );
+        }
+
+        return 0;
+    });
+}
+
+ASTNode::ptr arrayand( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return map_elements( location, env, args, MAP_AND );
+}
+
+ASTNode::ptr arrayor( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return map_elements( location, env, args, MAP_OR );
+}
+
+ASTNode::ptr arrayxor( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return map_elements( location, env, args, MAP_XOR );
+}
+
+ASTNode::ptr arrayshl( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return map_elements( location, env, args, MAP_SHL );
+}
+
+ASTNode::ptr arrayshr( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return map_elements( location, env, args, MAP_SHR );
+}
+
+ASTNode::ptr arraysort( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return sort( location, env, args, ORDER_UNSIGNED );
+}
+
+ASTNode::ptr arraysignedsort( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return sort( location, env, args, ORDER_SIGNED );
+}
+
+ASTNode::ptr arrayfloatsort( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return sort( location, env, args, ORDER_FLOAT );
+}
+
+ASTNode::ptr arraynth( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return nth( location, env, args, ORDER_UNSIGNED );
+}
+
+ASTNode::ptr arraysignednth( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return nth( location, env, args, ORDER_SIGNED );
+}
+
+ASTNode::ptr arrayfloatnth( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return nth( location, env, args, ORDER_FLOAT );
+}
+
+ASTNode::ptr arraysearch( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return search( location, env, args, ORDER_UNSIGNED );
+}
+
+ASTNode::ptr arraysignedsearch( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return search( location, env, args, ORDER_SIGNED );
+}
+
+ASTNode::ptr arrayfloatsearch( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return search( location, env, args, ORDER_FLOAT );
+}
+
+} // namespace builtins
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Environment register functions
+//////////////////////////////////////////////////////////////////////////////
+
+void Environment::register_array_functions( BuiltinManager* manager )
+{
+    manager->register_function( "arraysum", builtins::arraysum );
+    manager->register_function( "arraymin", builtins::arraymin );
+    manager->register_function( "arraymax", builtins::arraymax );
+    manager->register_function( "arrayfind", builtins::arrayfind );
+    manager->register_function( "arraycount", builtins::arraycount );
+    manager->register_function( "arraynth", builtins::arraynth );
+    manager->register_function( "arraysignednth", builtins::arraysignednth );
+    manager->register_function( "arrayfloatnth", builtins::arrayfloatnth );
+    manager->register_function( "arraysearch", builtins::arraysearch );
+    manager->register_function( "arraysignedsearch", builtins::arraysignedsearch );
+    manager->register_function( "arrayfloatsearch", builtins::arrayfloatsearch );
+}
+
+void Environment::register_array_arrayfuncs( BuiltinManager* manager )
+{
+    manager->register_function( "arrayfill", builtins::arrayfill, true );
+    manager->register_function( "arraycopy", builtins::arraycopy, true );
+    manager->register_function( "arrayand", builtins::arrayand, true );
+    manager->register_function( "arrayor", builtins::arrayor, true );
+    manager->register_function( "arrayxor", builtins::arrayxor, true );
+    manager->register_function( "arrayshl", builtins::arrayshl, true );
+    manager->register_function( "arrayshr", builtins::arrayshr, true );
+    manager->register_function( "arraysort", builtins::arraysort, true );
+    manager->register_function( "arraysignedsort", builtins::arraysignedsort, true );
+    manager->register_function( "arrayfloatsort", builtins::arrayfloatsort, true );
+}
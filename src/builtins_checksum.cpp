@@ -0,0 +1,171 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "builtins.h"
+#include "mempeek_ast.h"
+#include "crc32.h"
+#include "hash64.h"
+
+#include <vector>
+#include <memory>
+
+using namespace std;
+
+namespace builtins {
+
+
+//////////////////////////////////////////////////////////////////////////////
+// checksum helpers
+//////////////////////////////////////////////////////////////////////////////
+
+typedef uint64_t (*checksum_t)( const void* data, size_t size, uint64_t init );
+
+static uint64_t crc32_checksum( const void* data, size_t size, uint64_t init )
+{
+    return ::crc32( data, size, (uint32_t)init );
+}
+
+static uint64_t crc32c_checksum( const void* data, size_t size, uint64_t init )
+{
+    return ::crc32c( data, size, (uint32_t)init );
+}
+
+static uint64_t hash64_checksum( const void* data, size_t size, uint64_t init )
+{
+    return ::hash64( data, size, init );
+}
+
+// checksum over the packed elements of an array, as they are stored in memory
+static uint64_t checksum_array( Environment::array* array, uint64_t init, checksum_t checksum )
+{
+    return checksum( array->get_buffer(), array->get_size() * array->get_width(), init );
+}
+
+// checksum over size bytes of mapped memory. Plain memory is read in place,
+// device memory is copied within one guard with 32 bit accesses if address
+// and size allow it, otherwise with 8 bit accesses.
+static uint64_t checksum_memory( const yylloc_t& location, MappingCache& mapping, void* address, uint64_t size,
+                                 uint64_t init, checksum_t checksum )
+{
+    MMap* mmap = mapping.get_block( location, address, 1, size );
+
+    const void* memory = mmap->get_memory( address );
+    if( memory ) return checksum( memory, size, init );
+
+    vector< uint32_t > buffer( ( size + 3 ) / 4 );
+    bool is_ok;
+
+    if( (uintptr_t)address % 4 == 0 && size % 4 == 0 ) is_ok = mmap->read_block< uint32_t >( address, buffer.data(), size / 4 );
+    else is_ok = mmap->read_block< uint8_t >( address, (uint8_t*)buffer.data(), size );
+
+    if( !is_ok ) throw ASTExceptionBusError( location, MMap::get_fault_address(), MMap::get_fault_size() );
+
+    return checksum( buffer.data(), size, init );
+}
+
+template< checksum_t CHECKSUM >
+static ASTNode::ptr array_checksum( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    if( args.size() == 1 ) {
+        return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+            return checksum_array( args[0].array, 0, CHECKSUM );
+        });
+    }
+    else {
+        return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+            return checksum_array( args[0].array, args[1].value, CHECKSUM );
+        });
+    }
+}
+
+template< checksum_t CHECKSUM >
+static ASTNode::ptr memory_checksum( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    // memory changes between calls, the results are never folded
+    shared_ptr< MappingCache > mapping = make_shared< MappingCache >( env );
+
+    if( args.size() == 2 ) {
+        return make_node< ASTNodeBuiltin<2> >( location, env, args, [location, mapping] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+            return checksum_memory( location, *mapping, (void*)args[0].value, args[1].value, 0, CHECKSUM );
+        }, false );
+    }
+    else {
+        return make_node< ASTNodeBuiltin<3> >( location, env, args, [location, mapping] ( const ASTNodeBuiltin<3>::args_t& args ) -> uint64_t {
+            return checksum_memory( location, *mapping, (void*)args[0].value, args[1].value, args[2].value, CHECKSUM );
+        }, false );
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// builtin function node creators
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNode::ptr crc32( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return array_checksum< crc32_checksum >( location, env, args );
+}
+
+ASTNode::ptr crc32c( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return array_checksum< crc32c_checksum >( location, env, args );
+}
+
+ASTNode::ptr hash64( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return array_checksum< hash64_checksum >( location, env, args );
+}
+
+ASTNode::ptr memcrc32( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return memory_checksum< crc32_checksum >( location, env, args );
+}
+
+ASTNode::ptr memcrc32c( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return memory_checksum< crc32c_checksum >( location, env, args );
+}
+
+ASTNode::ptr memhash64( const yylloc_t& location, Environment* env, const arglist_t& args )
+{
+    return memory_checksum< hash64_checksum >( location, env, args );
+}
+
+} // namespace builtins
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Environment register functions
+//////////////////////////////////////////////////////////////////////////////
+
+void Environment::register_checksum_functions( BuiltinManager* manager )
+{
+    manager->register_function( "crc32", builtins::crc32 );
+    manager->register_function( "crc32c", builtins::crc32c );
+    manager->register_function( "hash64", builtins::hash64 );
+    manager->register_function( "memcrc32", builtins::memcrc32 );
+    manager->register_function( "memcrc32c", builtins::memcrc32c );
+    manager->register_function( "memhash64", builtins::memhash64 );
+}
@@ -39,7 +39,7 @@ namespace builtins {
 
 ASTNode::ptr int2float( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = args[0].value;
         return *(int64_t*)&d1;
     });
@@ -47,7 +47,7 @@ ASTNode::ptr int2float( const yylloc_t& location, Environment* env, const arglis
 
 ASTNode::ptr float2int( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         return (uint64_t)(int64_t)d1;
     });
@@ -55,7 +55,7 @@ ASTNode::ptr float2int( const yylloc_t& location, Environment* env, const arglis
 
 ASTNode::ptr fadd( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = *(double*)(args + 1);
         double d3 = d1 + d2;
@@ -65,7 +65,7 @@ ASTNode::ptr fadd( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fsub( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = *(double*)(args + 1);
         double d3 = d1 - d2;
@@ -75,7 +75,7 @@ ASTNode::ptr fsub( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fmul( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = *(double*)(args + 1);
         double d3 = d1 * d2;
@@ -85,7 +85,7 @@ ASTNode::ptr fmul( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fdiv( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = *(double*)(args + 1);
         double d3 = d1 / d2;
@@ -95,7 +95,7 @@ ASTNode::ptr fdiv( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fsqrt( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = sqrt( d1 );
         return *(uint64_t*)&d2;
@@ -104,7 +104,7 @@ ASTNode::ptr fsqrt( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fpow( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2> >( location, env, args, [] ( const ASTNodeBuiltin<2>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = *(double*)(args + 1);
         double d3 = pow( d1, d2 );
@@ -114,7 +114,7 @@ ASTNode::ptr fpow( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fexp( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = exp( d1 );
         return *(uint64_t*)&d2;
@@ -123,7 +123,7 @@ ASTNode::ptr fexp( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr flog( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = log( d1 );
         return *(uint64_t*)&d2;
@@ -132,7 +132,7 @@ ASTNode::ptr flog( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fsin( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = sin( d1 );
         return *(uint64_t*)&d2;
@@ -141,7 +141,7 @@ ASTNode::ptr fsin( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fcos( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = cos( d1 );
         return *(uint64_t*)&d2;
@@ -150,7 +150,7 @@ ASTNode::ptr fcos( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr ftan( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = tan( d1 );
         return *(uint64_t*)&d2;
@@ -159,7 +159,7 @@ ASTNode::ptr ftan( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fasin( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = asin( d1 );
         return *(uint64_t*)&d2;
@@ -168,7 +168,7 @@ ASTNode::ptr fasin( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr facos( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = acos( d1 );
         return *(uint64_t*)&d2;
@@ -177,7 +177,7 @@ ASTNode::ptr facos( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fatan( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = atan( d1 );
         return *(uint64_t*)&d2;
@@ -186,7 +186,7 @@ ASTNode::ptr fatan( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fabs( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = ::fabs( d1 );
         return *(uint64_t*)&d2;
@@ -195,7 +195,7 @@ ASTNode::ptr fabs( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr ffloor( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = floor( d1 );
         return *(uint64_t*)&d2;
@@ -204,7 +204,7 @@ ASTNode::ptr ffloor( const yylloc_t& location, Environment* env, const arglist_t
 
 ASTNode::ptr fceil( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = ceil( d1 );
         return *(uint64_t*)&d2;
@@ -213,7 +213,7 @@ ASTNode::ptr fceil( const yylloc_t& location, Environment* env, const arglist_t&
 
 ASTNode::ptr fround( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1> >( location, env, args, [] ( const ASTNodeBuiltin<1>::args_t& args ) -> uint64_t {
         double d1 = *(double*)(args + 0);
         double d2 = round( d1 );
         return *(uint64_t*)&d2;
@@ -31,25 +31,34 @@
 #include <deque>
 #include <string>
 #include <algorithm>
-#include <regex>
+
+#include <string.h>
 
 using namespace std;
 
 namespace builtins {
 
-std::vector< std::string > TOKENS;
-
-
 //////////////////////////////////////////////////////////////////////////////
 // builtin function node creators
 //////////////////////////////////////////////////////////////////////////////
 
 ASTNode::ptr strcat( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<3,0x07> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x07>::args_t& args ) -> uint64_t {
-        string str1 = ASTNodeString::get_string( args[1].array );
-        string str2 = ASTNodeString::get_string( args[2].array );
-        ASTNodeString::set_string( args[0].array, str1 + str2 );
+    return make_node< ASTNodeBuiltin<3,0x07> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x07>::args_t& args ) -> uint64_t {
+        size_t len1, len2;
+        const char* str1 = ASTNodeString::get_chars( args[1].array, len1 );
+        const char* str2 = ASTNodeString::get_chars( args[2].array, len2 );
+
+        if( len2 > 0 && str2 == args[0].array->get_buffer() && str1 != str2 ) {
+            // the second string would be overwritten by the first one
+            string str( str1, len1 );
+            str.append( str2, len2 );
+            ASTNodeString::set_string( args[0].array, str );
+        }
+        else {
+            ASTNodeString::set_string( args[0].array, str1, len1 );
+            ASTNodeString::append_string( args[0].array, str2, len2 );
+        }
 
     	return 0;
     });
@@ -57,16 +66,14 @@ ASTNode::ptr strcat( const yylloc_t& location, Environment* env, const arglist_t
 
 ASTNode::ptr substr( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<4,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<4,0x03>::args_t& args ) -> uint64_t {
-    	string str = ASTNodeString::get_string( args[1].array );
+    return make_node< ASTNodeBuiltin<4,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<4,0x03>::args_t& args ) -> uint64_t {
+    	size_t length;
+    	const char* str = ASTNodeString::get_chars( args[1].array, length );
     	uint64_t pos = args[2].value;
     	uint64_t len = args[3].value;
 
-    	if( pos < str.length() ) {
-    		if( len < str.length() ) ASTNodeString::set_string( args[0].array, str.substr( pos, len ) );
-    		else ASTNodeString::set_string( args[0].array, str.substr( pos ) );
-    	}
-    	else ASTNodeString::set_string( args[0].array, "" );
+    	if( pos < length ) ASTNodeString::set_string( args[0].array, str + pos, min( len, length - pos ) );
+    	else ASTNodeString::set_string( args[0].array, "", 0 );
 
     	return 0;
     });
@@ -74,8 +81,9 @@ ASTNode::ptr substr( const yylloc_t& location, Environment* env, const arglist_t
 
 ASTNode::ptr getline( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [env] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
     	string line;
+    	env->get_printbuffer().flush();
     	std::getline( cin, line );
     	ASTNodeString::set_string( args[0].array, line );
 
@@ -85,18 +93,20 @@ ASTNode::ptr getline( const yylloc_t& location, Environment* env, const arglist_
 
 ASTNode::ptr strlen( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
         return ASTNodeString::get_length( args[0].array );
     });
 }
 
 ASTNode::ptr strcmp( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x03>::args_t& args ) -> uint64_t {
-		string str1 = ASTNodeString::get_string( args[0].array );
-		string str2 = ASTNodeString::get_string( args[1].array );
+    return make_node< ASTNodeBuiltin<2,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x03>::args_t& args ) -> uint64_t {
+		size_t len1, len2;
+		const char* str1 = ASTNodeString::get_chars( args[0].array, len1 );
+		const char* str2 = ASTNodeString::get_chars( args[1].array, len2 );
 
-		int ret = ::strcmp( str1.c_str(), str2.c_str() );
+		int ret = memcmp( str1, str2, min( len1, len2 ) );
+		if( ret == 0 ) ret = (len1 > len2) - (len1 < len2);
 
 		if( ret < 0 ) return 0;
 		else if( ret > 0 ) return 2;
@@ -106,61 +116,46 @@ ASTNode::ptr strcmp( const yylloc_t& location, Environment* env, const arglist_t
 
 ASTNode::ptr str2int( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
     	return Environment::parse_int( ASTNodeString::get_string( args[0].array ) );
     });
 }
 
 ASTNode::ptr str2float( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
     	return Environment::parse_float( ASTNodeString::get_string( args[0].array ) );
     });
 }
 
-void tokenize_string( string text, string separator )
-{
-	regex pattern( separator );
-	TOKENS.clear();
-
-	for_each( sregex_token_iterator( text.begin(), text.end(), pattern, -1 ),
-			  sregex_token_iterator(),
-			  [] ( string token )
-	{
-		TOKENS.push_back( token );
-	});
-}
-
 ASTNode::ptr tokenize( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
 	if( args.size() == 1 ) {
-		return make_shared< ASTNodeBuiltin<1,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
-			string text = ASTNodeString::get_string( args[0].array );
+		return make_node< ASTNodeBuiltin<1,0x01> >( location, env, args, [env] ( const ASTNodeBuiltin<1,0x01>::args_t& args ) -> uint64_t {
+			size_t length;
+			const char* text = ASTNodeString::get_chars( args[0].array, length );
 
-			tokenize_string( text, "\\s+" );
-
-			return TOKENS.size();
+			return env->get_tokenizer().tokenize( text, length );
 		});
 	}
 	else {
-	    return make_shared< ASTNodeBuiltin<2,0x03> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x03>::args_t& args ) -> uint64_t {
-	    	string text = ASTNodeString::get_string( args[0].array );
-	    	string separator = ASTNodeString::get_string( args[1].array );
-
-	    	tokenize_string( text, separator );
+	    return make_node< ASTNodeBuiltin<2,0x03> >( location, env, args, [env] ( const ASTNodeBuiltin<2,0x03>::args_t& args ) -> uint64_t {
+	    	size_t length, separator_length;
+	    	const char* text = ASTNodeString::get_chars( args[0].array, length );
+	    	const char* separator = ASTNodeString::get_chars( args[1].array, separator_length );
 
-	    	return TOKENS.size();
+	    	return env->get_tokenizer().tokenize( text, length, separator, separator_length );
 	    });
 	}
 }
 
 ASTNode::ptr gettoken( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
-    	uint64_t index = args[1].value;
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [env] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+    	size_t length;
+    	const char* token = env->get_tokenizer().get_token( args[1].value, length );
 
-    	if( index < TOKENS.size() ) ASTNodeString::set_string( args[0].array, TOKENS[index] );
-    	else ASTNodeString::set_string( args[0].array, "" );
+    	ASTNodeString::set_string( args[0].array, token, length );
 
     	return 0;
     });
@@ -168,7 +163,7 @@ ASTNode::ptr gettoken( const yylloc_t& location, Environment* env, const arglist
 
 ASTNode::ptr int2str( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
     	ostringstream ostr;
     	ostr << args[1].value;
 
@@ -180,7 +175,7 @@ ASTNode::ptr int2str( const yylloc_t& location, Environment* env, const arglist_
 
 ASTNode::ptr signed2str( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
     	int64_t value = args[1].value;
 
     	ostringstream ostr;
@@ -196,7 +191,7 @@ ASTNode::ptr hex2str( const yylloc_t& location, Environment* env, const arglist_
 {
 
 	if( args.size() == 2 ) {
-		return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+		return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
 			ostringstream ostr;
 			ostr << "0x" << hex << args[1].value;
 
@@ -206,7 +201,7 @@ ASTNode::ptr hex2str( const yylloc_t& location, Environment* env, const arglist_
 		});
 	}
 	else {
-		return make_shared< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
+		return make_node< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
 			ostringstream ostr;
 			ostr << "0x" << hex << setw( args[2].value ) << setfill('0') << args[1].value;
 
@@ -221,7 +216,7 @@ ASTNode::ptr hex2str( const yylloc_t& location, Environment* env, const arglist_
 ASTNode::ptr bin2str( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
 	if( args.size() == 2 ) {
-		return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+		return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
 			uint64_t value = args[1].value;
 
 			deque<char> bin;
@@ -240,7 +235,7 @@ ASTNode::ptr bin2str( const yylloc_t& location, Environment* env, const arglist_
 		});
 	}
 	else {
-		return make_shared< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
+		return make_node< ASTNodeBuiltin<3,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<3,0x01>::args_t& args ) -> uint64_t {
 			uint64_t value = args[1].value;
 			ssize_t size = args[2].value;
 
@@ -263,7 +258,7 @@ ASTNode::ptr bin2str( const yylloc_t& location, Environment* env, const arglist_
 
 ASTNode::ptr float2str( const yylloc_t& location, Environment* env, const arglist_t& args )
 {
-    return make_shared< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
+    return make_node< ASTNodeBuiltin<2,0x01> >( location, env, args, [] ( const ASTNodeBuiltin<2,0x01>::args_t& args ) -> uint64_t {
     	double value = *(double*)&(args[1].value);
 
     	ostringstream ostr;
@@ -293,8 +288,8 @@ void Environment::register_string_functions( BuiltinManager* manager )
 
 void Environment::register_string_arrayfuncs( BuiltinManager* manager )
 {
-    manager->register_function( "strcat", builtins::strcat );
-    manager->register_function( "substr", builtins::substr );
+    manager->register_function( "strcat", builtins::strcat, true );
+    manager->register_function( "substr", builtins::substr, true );
     manager->register_function( "getline", builtins::getline );
     manager->register_function( "gettoken", builtins::gettoken );
     manager->register_function( "int2str", builtins::int2str );
@@ -0,0 +1,385 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "bytecode.h"
+
+#include "mempeek_ast.h"
+#include "mempeek_exceptions.h"
+#include "mmap.h"
+
+#include <assert.h>
+#include <alloca.h>
+
+#ifdef ASTDEBUG
+#include <iostream>
+#endif
+
+using namespace std;
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Bytecode implementation
+//////////////////////////////////////////////////////////////////////////////
+
+Bytecode::Bytecode( Environment* env )
+ : m_Env( env )
+{}
+
+void Bytecode::compile( ASTNode* root )
+{
+#ifdef ASTDEBUG
+    cerr << "BC[" << this << "]: compiling ASTNode[" << root << "]" << endl;
+#endif
+
+    m_Root = root;
+
+    begin_unit();
+    root->compile( *this );
+    pop_regs( 0 );
+    end_unit();
+
+    emit( OP_END );
+
+#ifdef ASTDEBUG
+    cerr << "BC[" << this << "]: " << m_Code.size() << " instructions, " << m_NumRegs << " registers" << endl;
+#endif
+}
+
+void Bytecode::execute()
+{
+#ifdef ASTDEBUG
+    cerr << "BC[" << this << "]: executing" << endl;
+#endif
+
+    // the register file lives on the stack, so recursive subroutine calls get
+    // their own registers and nothing leaks when an exception unwinds the call
+    uint64_t* regs = (uint64_t*)alloca( (m_NumRegs + 1) * sizeof(uint64_t) );
+
+    run( regs, 0 );
+}
+
+size_t Bytecode::emit( opcode_t opcode, reg_t a, reg_t b, reg_t c )
+{
+    return emit_value( opcode, a, b, c, 0 );
+}
+
+size_t Bytecode::emit_value( opcode_t opcode, reg_t a, reg_t b, reg_t c, uint64_t value )
+{
+    instruction_t instruction;
+    instruction.opcode = opcode;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.c = c;
+    instruction.arg.value = value;
+
+    m_Code.push_back( instruction );
+    return m_Code.size() - 1;
+}
+
+size_t Bytecode::emit_node( opcode_t opcode, reg_t a, reg_t b, reg_t c, ASTNode* node )
+{
+    // interpreted nodes access the locals of the subroutine frame directly
+    if( opcode == OP_EXEC && !m_Inlines.empty() ) m_Inlines.back().failed = true;
+
+    size_t pos = emit( opcode, a, b, c );
+    m_Code[ pos ].arg.node = node;
+    return pos;
+}
+
+size_t Bytecode::emit_var( opcode_t opcode, reg_t a, VarManager::var* var )
+{
+    // locals of inlined subroutines live in registers
+    for( auto iter = m_VarRegs.rbegin(); iter != m_VarRegs.rend(); iter++ ) {
+        if( iter->first != var ) continue;
+
+        if( opcode == OP_LOAD ) return emit( OP_MOVE, a, iter->second );
+        else return emit( OP_MOVE, iter->second, a );
+    }
+
+    size_t pos = emit( opcode, a );
+    m_Code[ pos ].arg.var = var;
+    return pos;
+}
+
+size_t Bytecode::emit_array( opcode_t opcode, reg_t a, reg_t b, reg_t c, ArrayManager::array* array )
+{
+    size_t pos = emit( opcode, a, b, c );
+    m_Code[ pos ].arg.array = array;
+    return pos;
+}
+
+void Bytecode::set_target( size_t instruction, size_t target )
+{
+    m_Code[ instruction ].arg.target = target;
+}
+
+void Bytecode::begin_unit()
+{
+    m_Units.emplace_back();
+    m_Units.back().guard_depth = m_GuardDepth;
+}
+
+void Bytecode::end_unit()
+{
+    for( size_t pos: m_Units.back().exits ) set_target( pos, get_position() );
+    m_Units.pop_back();
+}
+
+void Bytecode::begin_loop()
+{
+    m_Units.back().loops.emplace_back();
+    m_Units.back().loops.back().guard_depth = m_GuardDepth;
+}
+
+void Bytecode::end_loop()
+{
+    for( size_t pos: m_Units.back().loops.back().breaks ) set_target( pos, get_position() );
+    m_Units.back().loops.pop_back();
+}
+
+void Bytecode::emit_break()
+{
+    // break outside of a loop leaves the subroutine or script like exit
+    if( m_Units.back().loops.empty() ) emit_exit();
+    else {
+        loop_t& loop = m_Units.back().loops.back();
+        emit_leave_guards( loop.guard_depth );
+        loop.breaks.push_back( emit( OP_JUMP ) );
+    }
+}
+
+void Bytecode::emit_exit()
+{
+    emit_leave_guards( m_Units.back().guard_depth );
+    m_Units.back().exits.push_back( emit( OP_JUMP ) );
+}
+
+void Bytecode::begin_guard()
+{
+    m_GuardDepth++;
+}
+
+void Bytecode::end_guard()
+{
+    m_GuardDepth--;
+}
+
+bool Bytecode::begin_inline( ASTNode* body )
+{
+    if( body == m_Root || m_Inlines.size() >= MAX_INLINE_DEPTH ) return false;
+
+    for( const inline_t& inl: m_Inlines ) {
+        if( inl.body == body ) return false;
+    }
+
+    inline_t inl;
+    inl.body = body;
+    inl.start = get_position();
+    inl.top = m_Top;
+    inl.num_vars = m_VarRegs.size();
+    inl.guard_depth = m_GuardDepth;
+    inl.failed = false;
+
+    m_Inlines.push_back( inl );
+    return true;
+}
+
+void Bytecode::map_var( VarManager::var* var, reg_t reg )
+{
+    m_VarRegs.push_back( std::make_pair( var, reg ) );
+}
+
+void Bytecode::begin_inline_body()
+{
+    // the body is compiled like a separate subroutine: exit and break end the
+    // body, and accesses are checked unless the body has its own guard
+    m_GuardDepth = 0;
+    begin_unit();
+}
+
+void Bytecode::end_inline_body()
+{
+    end_unit();
+    m_GuardDepth = m_Inlines.back().guard_depth;
+}
+
+bool Bytecode::end_inline()
+{
+    inline_t inl = m_Inlines.back();
+    m_Inlines.pop_back();
+    m_VarRegs.resize( inl.num_vars );
+
+    if( !inl.failed && get_position() - inl.start <= MAX_INLINE_INSTRUCTIONS ) return true;
+
+    m_Code.resize( inl.start );
+    m_Top = inl.top;
+    return false;
+}
+
+void Bytecode::emit_leave_guards( size_t guard_depth )
+{
+    // each OP_GUARD_END returns from one nested run() to the next instruction
+    for( size_t depth = m_GuardDepth; depth > guard_depth; depth-- ) emit( OP_GUARD_END );
+}
+
+size_t Bytecode::run_guarded( uint64_t* regs, size_t start, ASTNode* node )
+{
+    // the guarded block runs in a nested run() inside a single recovery window.
+    // Only the unchecked accesses of this block rely on it, everything called
+    // from here arms its own window, so a bus error never unwinds C++ frames.
+    size_t next = 0;
+
+    if( !MMap::guard( [&] { next = run( regs, start ); } ) ) {
+        throw ASTExceptionBusError( node->get_location(), MMap::get_fault_address(), MMap::get_fault_size() );
+    }
+
+    return next;
+}
+
+size_t Bytecode::run( uint64_t* regs, size_t start )
+{
+    const instruction_t* code = m_Code.data();
+    const instruction_t* ip = code + start;
+
+    for(;;) {
+        const instruction_t& i = *ip++;
+
+        switch( i.opcode ) {
+        case OP_END: return ip - code;
+
+        case OP_CONST: regs[ i.a ] = i.arg.value; break;
+        case OP_MOVE: regs[ i.a ] = regs[ i.b ]; break;
+        case OP_LOAD: regs[ i.a ] = i.arg.var->get(); break;
+        case OP_STORE: i.arg.var->set( regs[ i.a ] ); break;
+
+        case OP_EXEC: regs[ i.a ] = i.arg.node->execute(); break;
+        case OP_CALL: regs[ i.a ] = i.arg.node->call( regs + i.b ); break;
+
+        case OP_JUMP: ip = code + i.arg.target; break;
+        case OP_JUMP_ZERO: if( regs[ i.a ] == 0 ) ip = code + i.arg.target; break;
+
+        case OP_JUMP_FOR_END: {
+            const int64_t index = regs[ i.a ];
+            const int64_t to = regs[ i.b ];
+            const int64_t step = regs[ i.c ];
+            if( !((step > 0 && index <= to) || (step < 0 && index >= to)) ) ip = code + i.arg.target;
+            break;
+        }
+
+        case OP_CHECK_TERMINATE: if( m_Env->is_terminated() ) throw ASTExceptionTerminate(); break;
+        case OP_QUIT: throw ASTExceptionQuit();
+
+        case OP_GUARD: ip = code + run_guarded( regs, ip - code, i.arg.node ); break;
+        case OP_GUARD_END: return ip - code;
+        case OP_CHECK_DROPPED: static_cast< ASTNodeSubroutine* >( i.arg.node )->check_dropped(); break;
+
+        case OP_ARRAY_GET: regs[ i.a ] = i.arg.array->get( regs[ i.b ] ); break;
+        case OP_ARRAY_SET: i.arg.array->set( regs[ i.a ], regs[ i.b ] ); break;
+        case OP_ARRAY_SIZE: regs[ i.a ] = i.arg.array->get_size(); break;
+        case OP_RANGE: regs[ i.a ] = static_cast< ASTNodeRange* >( i.arg.node )->get_address( regs[ i.b ] ); break;
+
+        case OP_PEEK8: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek< uint8_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK16: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek< uint16_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK32: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek< uint32_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK64: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek< uint64_t >( (void*)regs[ i.b ] ); break;
+
+        case OP_POKE8: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint8_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE16: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint16_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE32: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint32_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE64: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint64_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+
+        case OP_POKE8_MASK: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint8_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE16_MASK: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint16_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE32_MASK: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint32_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE64_MASK: static_cast< ASTNodePoke* >( i.arg.node )->poke< uint64_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+
+        case OP_PEEK8_UNCHECKED: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek_unchecked< uint8_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK16_UNCHECKED: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek_unchecked< uint16_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK32_UNCHECKED: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek_unchecked< uint32_t >( (void*)regs[ i.b ] ); break;
+        case OP_PEEK64_UNCHECKED: regs[ i.a ] = static_cast< ASTNodePeek* >( i.arg.node )->peek_unchecked< uint64_t >( (void*)regs[ i.b ] ); break;
+
+        case OP_POKE8_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint8_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE16_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint16_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE32_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint32_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+        case OP_POKE64_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint64_t >( (void*)regs[ i.a ], regs[ i.b ] ); break;
+
+        case OP_POKE8_MASK_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint8_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE16_MASK_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint16_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE32_MASK_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint32_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+        case OP_POKE64_MASK_UNCHECKED: static_cast< ASTNodePoke* >( i.arg.node )->poke_unchecked< uint64_t >( (void*)regs[ i.a ], regs[ i.b ], regs[ i.c ] ); break;
+
+        case OP_NEG: regs[ i.a ] = -regs[ i.b ]; break;
+        case OP_BIT_NOT: regs[ i.a ] = ~regs[ i.b ]; break;
+        case OP_LOG_NOT: regs[ i.a ] = regs[ i.b ] ? 0 : 0xffffffffffffffff; break;
+        case OP_AND_CONST: regs[ i.a ] = regs[ i.b ] & i.arg.value; break;
+
+        case OP_ADD: regs[ i.a ] = regs[ i.b ] + regs[ i.c ]; break;
+        case OP_SUB: regs[ i.a ] = regs[ i.b ] - regs[ i.c ]; break;
+        case OP_MUL: regs[ i.a ] = regs[ i.b ] * regs[ i.c ]; break;
+
+        case OP_DIV:
+            if( regs[ i.c ] == 0 ) throw ASTExceptionDivisionByZero( i.arg.node->get_location() );
+            regs[ i.a ] = regs[ i.b ] / regs[ i.c ];
+            break;
+
+        case OP_MOD:
+            if( regs[ i.c ] == 0 ) throw ASTExceptionDivisionByZero( i.arg.node->get_location() );
+            regs[ i.a ] = regs[ i.b ] % regs[ i.c ];
+            break;
+
+        case OP_SDIV:
+            if( regs[ i.c ] == 0 ) throw ASTExceptionDivisionByZero( i.arg.node->get_location() );
+            regs[ i.a ] = (int64_t)regs[ i.b ] / (int64_t)regs[ i.c ];
+            break;
+
+        case OP_SMOD:
+            if( regs[ i.c ] == 0 ) throw ASTExceptionDivisionByZero( i.arg.node->get_location() );
+            regs[ i.a ] = (int64_t)regs[ i.b ] % (int64_t)regs[ i.c ];
+            break;
+
+        case OP_LSHIFT: regs[ i.a ] = regs[ i.b ] << regs[ i.c ]; break;
+        case OP_RSHIFT: regs[ i.a ] = regs[ i.b ] >> regs[ i.c ]; break;
+
+        case OP_LT: regs[ i.a ] = (regs[ i.b ] < regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_GT: regs[ i.a ] = (regs[ i.b ] > regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_LE: regs[ i.a ] = (regs[ i.b ] <= regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_GE: regs[ i.a ] = (regs[ i.b ] >= regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_EQ: regs[ i.a ] = (regs[ i.b ] == regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_NE: regs[ i.a ] = (regs[ i.b ] != regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_SLT: regs[ i.a ] = ((int64_t)regs[ i.b ] < (int64_t)regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_SGT: regs[ i.a ] = ((int64_t)regs[ i.b ] > (int64_t)regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_SLE: regs[ i.a ] = ((int64_t)regs[ i.b ] <= (int64_t)regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+        case OP_SGE: regs[ i.a ] = ((int64_t)regs[ i.b ] >= (int64_t)regs[ i.c ]) ? 0xffffffffffffffff : 0; break;
+
+        case OP_BIT_AND: regs[ i.a ] = regs[ i.b ] & regs[ i.c ]; break;
+        case OP_BIT_XOR: regs[ i.a ] = regs[ i.b ] ^ regs[ i.c ]; break;
+        case OP_BIT_OR: regs[ i.a ] = regs[ i.b ] | regs[ i.c ]; break;
+
+        case OP_LOG_AND: regs[ i.a ] = ((regs[ i.b ] != 0) && (regs[ i.c ] != 0)) ? 0xffffffffffffffff : 0; break;
+        case OP_LOG_XOR: regs[ i.a ] = ((regs[ i.b ] != 0) != (regs[ i.c ] != 0)) ? 0xffffffffffffffff : 0; break;
+        case OP_LOG_OR: regs[ i.a ] = ((regs[ i.b ] != 0) || (regs[ i.c ] != 0)) ? 0xffffffffffffffff : 0; break;
+        }
+    }
+}
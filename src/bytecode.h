@@ -0,0 +1,274 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __bytecode_h__
+#define __bytecode_h__
+
+#include "variables.h"
+#include "arrays.h"
+
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Bytecode
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNode;
+class Environment;
+
+class Bytecode {
+public:
+    typedef std::shared_ptr<Bytecode> ptr;
+
+    typedef uint16_t reg_t;
+
+    typedef enum : uint16_t {
+        OP_END,
+        OP_CONST,
+        OP_MOVE,
+        OP_LOAD,
+        OP_STORE,
+        OP_EXEC,
+        OP_CALL,
+        OP_JUMP,
+        OP_JUMP_ZERO,
+        OP_JUMP_FOR_END,
+        OP_CHECK_TERMINATE,
+        OP_QUIT,
+        OP_GUARD,
+        OP_GUARD_END,
+        OP_CHECK_DROPPED,
+
+        OP_ARRAY_GET,
+        OP_ARRAY_SET,
+        OP_ARRAY_SIZE,
+        OP_RANGE,
+
+        OP_PEEK8,
+        OP_PEEK16,
+        OP_PEEK32,
+        OP_PEEK64,
+        OP_POKE8,
+        OP_POKE16,
+        OP_POKE32,
+        OP_POKE64,
+        OP_POKE8_MASK,
+        OP_POKE16_MASK,
+        OP_POKE32_MASK,
+        OP_POKE64_MASK,
+
+        // same order as the checked accesses, see ASTNodePeek::compile()
+        OP_PEEK8_UNCHECKED,
+        OP_PEEK16_UNCHECKED,
+        OP_PEEK32_UNCHECKED,
+        OP_PEEK64_UNCHECKED,
+        OP_POKE8_UNCHECKED,
+        OP_POKE16_UNCHECKED,
+        OP_POKE32_UNCHECKED,
+        OP_POKE64_UNCHECKED,
+        OP_POKE8_MASK_UNCHECKED,
+        OP_POKE16_MASK_UNCHECKED,
+        OP_POKE32_MASK_UNCHECKED,
+        OP_POKE64_MASK_UNCHECKED,
+
+        OP_NEG,
+        OP_BIT_NOT,
+        OP_LOG_NOT,
+        OP_AND_CONST,
+
+        OP_ADD,
+        OP_SUB,
+        OP_MUL,
+        OP_DIV,
+        OP_MOD,
+        OP_SDIV,
+        OP_SMOD,
+        OP_LSHIFT,
+        OP_RSHIFT,
+        OP_LT,
+        OP_GT,
+        OP_LE,
+        OP_GE,
+        OP_EQ,
+        OP_NE,
+        OP_SLT,
+        OP_SGT,
+        OP_SLE,
+        OP_SGE,
+        OP_BIT_AND,
+        OP_BIT_XOR,
+        OP_BIT_OR,
+        OP_LOG_AND,
+        OP_LOG_XOR,
+        OP_LOG_OR
+    } opcode_t;
+
+    Bytecode( Environment* env );
+
+    void compile( ASTNode* root );
+
+    void execute();
+
+    // interface for ASTNode::compile()
+    reg_t get_top() const;
+    reg_t push_reg();
+    void pop_regs( reg_t top );
+
+    size_t get_position() const;
+
+    size_t emit( opcode_t opcode, reg_t a = 0, reg_t b = 0, reg_t c = 0 );
+    size_t emit_value( opcode_t opcode, reg_t a, reg_t b, reg_t c, uint64_t value );
+    size_t emit_node( opcode_t opcode, reg_t a, reg_t b, reg_t c, ASTNode* node );
+    size_t emit_var( opcode_t opcode, reg_t a, VarManager::var* var );
+    size_t emit_array( opcode_t opcode, reg_t a, reg_t b, reg_t c, ArrayManager::array* array );
+
+    void set_target( size_t instruction, size_t target );
+
+    void begin_unit();
+    void end_unit();
+
+    void begin_loop();
+    void end_loop();
+
+    void emit_break();
+    void emit_exit();
+
+    void begin_guard();
+    void end_guard();
+    bool is_guarded() const;
+
+    // inlining of subroutine bodies: begin_inline() returns false if the body
+    // must not be inlined here. The caller evaluates the arguments, maps the
+    // locals of the subroutine to registers with map_var() and compiles the
+    // body between begin_inline_body() and end_inline_body(). end_inline()
+    // returns false and removes all code emitted since begin_inline() if the
+    // body needs the interpreter or is too large.
+    bool begin_inline( ASTNode* body );
+    void map_var( VarManager::var* var, reg_t reg );
+    void begin_inline_body();
+    void end_inline_body();
+    bool end_inline();
+
+private:
+    typedef struct {
+        opcode_t opcode;
+        reg_t a;
+        reg_t b;
+        reg_t c;
+        union {
+            uint64_t value;
+            size_t target;
+            ASTNode* node;
+            VarManager::var* var;
+            ArrayManager::array* array;
+        } arg;
+    } instruction_t;
+
+    typedef struct {
+        std::vector< size_t > breaks;
+        size_t guard_depth;
+    } loop_t;
+
+    typedef struct {
+        std::vector< size_t > exits;
+        std::vector< loop_t > loops;
+        size_t guard_depth;
+    } unit_t;
+
+    typedef struct {
+        ASTNode* body;
+        size_t start;
+        reg_t top;
+        size_t num_vars;
+        size_t guard_depth;
+        bool failed;
+    } inline_t;
+
+    static const size_t MAX_INLINE_DEPTH = 4;
+    static const size_t MAX_INLINE_INSTRUCTIONS = 64;
+
+    void emit_leave_guards( size_t guard_depth );
+
+    size_t run( uint64_t* regs, size_t start );
+    size_t run_guarded( uint64_t* regs, size_t start, ASTNode* node );
+
+    Environment* m_Env;
+
+    std::vector< instruction_t > m_Code;
+
+    reg_t m_Top = 0;
+    reg_t m_NumRegs = 0;
+
+    std::vector< unit_t > m_Units;
+    size_t m_GuardDepth = 0;
+
+    ASTNode* m_Root = nullptr;
+    std::vector< inline_t > m_Inlines;
+    std::vector< std::pair< VarManager::var*, reg_t > > m_VarRegs;
+
+    Bytecode( const Bytecode& ) = delete;
+    Bytecode& operator=( const Bytecode& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Bytecode inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline Bytecode::reg_t Bytecode::get_top() const
+{
+    return m_Top;
+}
+
+inline Bytecode::reg_t Bytecode::push_reg()
+{
+    reg_t reg = m_Top++;
+    if( m_Top > m_NumRegs ) m_NumRegs = m_Top;
+    return reg;
+}
+
+inline void Bytecode::pop_regs( reg_t top )
+{
+    m_Top = top;
+}
+
+inline size_t Bytecode::get_position() const
+{
+    return m_Code.size();
+}
+
+inline bool Bytecode::is_guarded() const
+{
+    return m_GuardDepth > 0;
+}
+
+
+#endif // __bytecode_h__
@@ -0,0 +1,184 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "crc32.h"
+
+#if defined( __x86_64__ )
+#include <nmmintrin.h>
+#elif defined( __aarch64__ ) && defined( __ARM_FEATURE_CRC32 )
+#include <arm_acle.h>
+#define CRC32_ARMV8
+#endif
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// CRC-32 implementation
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const uint32_t CRC32_POLY = 0xedb88320;
+const uint32_t CRC32C_POLY = 0x82f63b78;
+
+// table[0] is the byte-wise table of the reflected polynomial, table[k]
+// additionally shifts the result over k zero bytes
+struct crc_tables {
+    crc_tables( uint32_t poly );
+
+    uint32_t table[8][256];
+};
+
+crc_tables::crc_tables( uint32_t poly )
+{
+    for( uint32_t i = 0; i < 256; i++ ) {
+        uint32_t crc = i;
+        for( int bit = 0; bit < 8; bit++ ) crc = ( crc >> 1 ) ^ ( ( crc & 1 ) ? poly : 0 );
+        table[0][i] = crc;
+    }
+
+    for( int k = 1; k < 8; k++ ) {
+        for( uint32_t i = 0; i < 256; i++ ) {
+            table[k][i] = ( table[k - 1][i] >> 8 ) ^ table[0][ table[k - 1][i] & 0xff ];
+        }
+    }
+}
+
+inline uint32_t read32le( const uint8_t* p )
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+inline uint64_t read64( const uint8_t* p )
+{
+    uint64_t value;
+    memcpy( &value, p, sizeof( value ) );
+    return value;
+}
+
+// slicing-by-8: eight independent table lookups per 8 bytes instead of a
+// dependency chain of eight byte-wise lookups
+uint32_t crc_sliced( const crc_tables& tables, const uint8_t* p, size_t size, uint32_t crc )
+{
+    const uint32_t (*t)[256] = tables.table;
+
+    for( ; size >= 8; size -= 8, p += 8 ) {
+        uint32_t lo = read32le( p ) ^ crc;
+        uint32_t hi = read32le( p + 4 );
+
+        crc = t[7][ lo & 0xff ] ^ t[6][ ( lo >> 8 ) & 0xff ] ^ t[5][ ( lo >> 16 ) & 0xff ] ^ t[4][ lo >> 24 ] ^
+              t[3][ hi & 0xff ] ^ t[2][ ( hi >> 8 ) & 0xff ] ^ t[1][ ( hi >> 16 ) & 0xff ] ^ t[0][ hi >> 24 ];
+    }
+
+    for( ; size > 0; size--, p++ ) crc = t[0][ ( crc ^ *p ) & 0xff ] ^ ( crc >> 8 );
+
+    return crc;
+}
+
+const crc_tables& get_crc32_tables()
+{
+    static const crc_tables tables( CRC32_POLY );
+    return tables;
+}
+
+const crc_tables& get_crc32c_tables()
+{
+    static const crc_tables tables( CRC32C_POLY );
+    return tables;
+}
+
+#if defined( __x86_64__ )
+
+__attribute__(( target( "sse4.2" ) ))
+uint32_t crc32c_sse42( const uint8_t* p, size_t size, uint32_t crc )
+{
+    uint64_t crc64 = crc;
+    for( ; size >= 8; size -= 8, p += 8 ) crc64 = _mm_crc32_u64( crc64, read64( p ) );
+
+    crc = (uint32_t)crc64;
+    for( ; size > 0; size--, p++ ) crc = _mm_crc32_u8( crc, *p );
+
+    return crc;
+}
+
+bool has_sse42()
+{
+    static const bool has_sse42 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports( "sse4.2" ) != 0;
+    }();
+
+    return has_sse42;
+}
+
+#endif
+
+#ifdef CRC32_ARMV8
+
+uint32_t crc32_armv8( const uint8_t* p, size_t size, uint32_t crc )
+{
+    for( ; size >= 8; size -= 8, p += 8 ) crc = __crc32d( crc, read64( p ) );
+    for( ; size > 0; size--, p++ ) crc = __crc32b( crc, *p );
+
+    return crc;
+}
+
+uint32_t crc32c_armv8( const uint8_t* p, size_t size, uint32_t crc )
+{
+    for( ; size >= 8; size -= 8, p += 8 ) crc = __crc32cd( crc, read64( p ) );
+    for( ; size > 0; size--, p++ ) crc = __crc32cb( crc, *p );
+
+    return crc;
+}
+
+#endif
+
+}
+
+uint32_t crc32( const void* data, size_t size, uint32_t crc )
+{
+    const uint8_t* p = static_cast< const uint8_t* >( data );
+
+#ifdef CRC32_ARMV8
+    return ~crc32_armv8( p, size, ~crc );
+#else
+    return ~crc_sliced( get_crc32_tables(), p, size, ~crc );
+#endif
+}
+
+uint32_t crc32c( const void* data, size_t size, uint32_t crc )
+{
+    const uint8_t* p = static_cast< const uint8_t* >( data );
+
+#if defined( CRC32_ARMV8 )
+    return ~crc32c_armv8( p, size, ~crc );
+#elif defined( __x86_64__ )
+    if( has_sse42() ) return ~crc32c_sse42( p, size, ~crc );
+    else return ~crc_sliced( get_crc32c_tables(), p, size, ~crc );
+#else
+    return ~crc_sliced( get_crc32c_tables(), p, size, ~crc );
+#endif
+}
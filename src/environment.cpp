@@ -25,7 +25,7 @@
 
 #include "environment.h"
 
-#include "md5.h"
+#include "hash64.h"
 #include "mempeek_ast.h"
 #include "mempeek_exceptions.h"
 #include "parser.h"
@@ -53,7 +53,9 @@ Environment::Environment()
  : m_DefaultSize( (sizeof(void*) == 8) ? T_64BIT : ((sizeof(void*) == 2) ? T_16BIT : T_32BIT) ),
    m_DefaultModifier( ASTNodePrint::MOD_HEX | ASTNodePrint::MOD_WORDSIZE ),
    m_IsTerminated( 0 ),
-   m_Stdout( &std::cout )
+   m_Completion( COMPLETION_NORMAL ),
+   m_Stdout( &std::cout ),
+   m_PrintBuffer( std::cout )
 {
     m_GlobalVars = new VarManager;
     m_GlobalArrays = new ArrayManager;
@@ -64,6 +66,9 @@ Environment::Environment()
     register_float_functions( m_BuiltinFunctions );
     register_string_functions( m_BuiltinFunctions );
     register_string_arrayfuncs( m_BuiltinArrayfuncs );
+    register_array_functions( m_BuiltinFunctions );
+    register_array_arrayfuncs( m_BuiltinArrayfuncs );
+    register_checksum_functions( m_BuiltinFunctions );
 
     m_ProcedureManager = new SubroutineManager( this );
     m_FunctionManager = new SubroutineManager( this );
@@ -74,7 +79,7 @@ Environment::Environment()
 
 Environment::~Environment()
 {
-	for( auto value: m_Mappings ) delete value.second;
+	for( MMap* mmap: m_Mappings ) delete mmap;
 
 	delete m_ProcedureManager;
 	delete m_FunctionManager;
@@ -96,13 +101,14 @@ std::shared_ptr<ASTNode> Environment::parse( const char* str, bool is_file, bool
 std::shared_ptr<ASTNode> Environment::parse( const yylloc_t& location, const char* str, bool is_file, bool run_once )
 {
     ASTNode::ptr yyroot = nullptr;
-    FILE* file = nullptr;
     char* curdir = nullptr;
     string filename = str;
-    MD5 md5;
+    string content;
+    string cachepath;
+    uint64_t hash = 0;
 
     if( is_file ) {
-        file = fopen( filename.c_str(), "r" );
+        FILE* file = fopen( filename.c_str(), "r" );
         if( !file ) {
             for( string path: m_IncludePaths ) {
                 if( path.length() > 0 && path.back() != '/' ) path += '/';
@@ -114,15 +120,40 @@ std::shared_ptr<ASTNode> Environment::parse( const yylloc_t& location, const cha
 
         if( !file ) throw ASTExceptionFileNotFound( location, str );
 
+        struct stat buf;
+        fileid_t id = {};
+        if( fstat( fileno( file ), &buf ) == 0 ) {
+            id = fileid_t( buf.st_dev, buf.st_ino, buf.st_size, buf.st_mtim.tv_sec, buf.st_mtim.tv_nsec );
+
+            // repeated imports of an unchanged file are skipped without reading it
+            if( run_once ) {
+                auto iter = m_ImportedFileIds.find( id );
+                if( iter != m_ImportedFileIds.end() && m_ImportedFiles.count( iter->second ) ) {
+                    fclose( file );
+                    return nullptr;
+                }
+            }
+
+            content.reserve( buf.st_size );
+        }
+
+        char buffer[4096];
+        for( size_t size; ( size = fread( buffer, 1, sizeof( buffer ), file ) ) > 0; ) content.append( buffer, size );
+        fclose( file );
+
+        // the content hash identifies imports and validates the token cache
+        hash = hash64( content.data(), content.size() );
+
         if( run_once ) {
-            md5.load( filename.c_str() );
+            m_ImportedFileIds[ id ] = hash;
 
-            if( m_ImportedFiles.find( md5 ) == m_ImportedFiles.end() ) m_ImportedFiles.insert( md5 );
+            if( m_ImportedFiles.find( hash ) == m_ImportedFiles.end() ) m_ImportedFiles.insert( hash );
             else return nullptr;
         }
 
         char* absname = realpath( filename.c_str(), nullptr );
         if( absname ) {
+            cachepath = absname;
             string newdir( absname );
             size_t last = newdir.find_last_of( '/' );
             if( last != string::npos ) {
@@ -134,30 +165,42 @@ std::shared_ptr<ASTNode> Environment::parse( const yylloc_t& location, const cha
         }
     }
 
-    yyscan_t scanner;
-    yylex_init( &scanner );
-    yyset_extra( is_file ? filename.c_str() : "", scanner );
+    const char* interned_filename = is_file ? intern_file_name( filename ) : "";
+
+    // tokens of cached script files are replayed without running the scanner
+    yyscan_t scanner = nullptr;
+    YY_BUFFER_STATE lex_buffer = nullptr;
+    TokenStream tokens( interned_filename );
+
+    bool is_cached = !cachepath.empty() && m_TokenCache.load( cachepath, hash, tokens );
+
+    if( !is_cached ) {
+        yylex_init( &scanner );
+        yyset_extra( interned_filename, scanner );
 
-    YY_BUFFER_STATE lex_buffer;
-    if( file ) lex_buffer = yy_create_buffer( file, YY_BUF_SIZE, scanner );
-    else lex_buffer = yy_scan_string( str, scanner );
+        if( is_file ) lex_buffer = yy_scan_bytes( content.data(), content.size(), scanner );
+        else lex_buffer = yy_scan_string( str, scanner );
 
-    yy_switch_to_buffer( lex_buffer, scanner );
+        yy_switch_to_buffer( lex_buffer, scanner );
+
+        tokens.set_scanner( scanner );
+        if( !cachepath.empty() ) tokens.start_recording();
+    }
 
     if( is_file ) {
         push_default_size();
         push_default_modifier();
     }
 
-    auto cleanup = [ this, lex_buffer, scanner, is_file, file, curdir ] () {
-        yy_delete_buffer( lex_buffer, scanner );
-        yylex_destroy( scanner );
+    auto cleanup = [ this, lex_buffer, scanner, is_file, curdir ] () {
+        if( scanner ) {
+            yy_delete_buffer( lex_buffer, scanner );
+            yylex_destroy( scanner );
+        }
 
         if( is_file ) {
             pop_default_size();
             pop_default_modifier();
-
-            fclose( file );
         }
 
         if( curdir ) {
@@ -166,13 +209,16 @@ std::shared_ptr<ASTNode> Environment::parse( const yylloc_t& location, const cha
         }
     };
 
+    // the nodes of this parse share one arena, it lives until the last node is gone
+    ASTArena::scope arena;
+
     try {
-        yyparse( scanner, this, yyroot );
+        yyparse( &tokens, this, yyroot );
     }
     catch( ... ) {
         cleanup();
 
-        if( is_file && run_once ) m_ImportedFiles.erase( md5 );
+        if( is_file && run_once ) m_ImportedFiles.erase( hash );
 
         if( m_SubroutineContext ) {
             m_SubroutineContext->abort_subroutine();
@@ -186,9 +232,20 @@ std::shared_ptr<ASTNode> Environment::parse( const yylloc_t& location, const cha
 
     cleanup();
 
+    if( tokens.is_recording() ) m_TokenCache.store( cachepath, hash, tokens );
+
     return yyroot;
 }
 
+Bytecode::ptr Environment::compile( std::shared_ptr<ASTNode> root )
+{
+    Bytecode::ptr bytecode = make_shared<Bytecode>( this );
+    if( root ) bytecode->compile( root.get() );
+    else bytecode->emit( Bytecode::OP_END );
+
+    return bytecode;
+}
+
 bool Environment::add_include_path( std::string path )
 {
     bool ret = false;
@@ -206,30 +263,39 @@ bool Environment::add_include_path( std::string path )
     return ret;
 }
 
-const Environment::var* Environment::get_var( std::string name )
+const char* Environment::intern_file_name( const std::string& name )
 {
+    return m_FileNames.insert( name ).first->c_str();
+}
+
+const Environment::var* Environment::get_var( const std::string& name )
+{
+    symbol_t symbol = SymbolTable::intern( name );
+
     if( m_LocalVars ) {
-        const Environment::var* var = m_LocalVars->get( name );
+        const Environment::var* var = m_LocalVars->get( symbol );
         if( var ) return var;
 
-        var = m_GlobalVars->get( name );
+        var = m_GlobalVars->get( symbol );
         if( var && var->is_def() ) return var;
         else return nullptr;
     }
-    else return m_GlobalVars->get( name );
+    else return m_GlobalVars->get( symbol );
 }
 
-Environment::array* Environment::get_array( std::string name )
+Environment::array* Environment::get_array( const std::string& name )
 {
+    symbol_t symbol = SymbolTable::intern( name );
+
     if( m_LocalArrays ) {
-        Environment::array* array = m_LocalArrays->get( name );
+        Environment::array* array = m_LocalArrays->get( symbol );
         if( array ) return array;
     }
 
-    return m_GlobalArrays->get( name );
+    return m_GlobalArrays->get( symbol );
 }
 
-std::set< std::string > Environment::get_autocompletion( std::string prefix )
+std::set< std::string > Environment::get_autocompletion( const std::string& prefix )
 {
     set< string > completions;
 
@@ -257,67 +323,117 @@ bool Environment::map_memory( void* phys_addr, void* map_addr, size_t size, std:
 
 	mmap->set_base_address( map_addr );
 
-	m_Mappings[ map_addr ] = mmap;
+	m_Mappings.push_back( mmap );
+
+	const uintptr_t first_chunk = (uintptr_t)map_addr >> MAPPING_CHUNK_SHIFT;
+	const uintptr_t last_chunk = ((uintptr_t)map_addr + size - 1) >> MAPPING_CHUNK_SHIFT;
+
+	// a mapping at the base address of an existing one replaces it, the old
+	// one is smaller and therefore only listed in chunks of the new one
+	MMap* replaced = nullptr;
+
+	for( uintptr_t chunk = first_chunk; chunk <= last_chunk; chunk++ ) {
+	    vector< MMap* >& candidates = m_MappingTable[ chunk ];
+
+	    auto pos = find_if( candidates.begin(), candidates.end(), [ map_addr ] ( MMap* candidate ) {
+	        return candidate->get_base_address() <= map_addr;
+	    });
+
+	    if( pos != candidates.end() && (*pos)->get_base_address() == map_addr ) {
+	        replaced = *pos;
+	        *pos = mmap;
+	    }
+	    else candidates.insert( pos, mmap );
+	}
+
+	if( replaced ) {
+	    m_Mappings.erase( find( m_Mappings.begin(), m_Mappings.end(), replaced ) );
+	    delete replaced;
+	}
+
+	// in order of ascending base address only the next mapping can be the
+	// lowest one with a higher base address
+	vector< MMap* > sorted( m_Mappings );
+	sort( sorted.begin(), sorted.end(), [] ( MMap* a, MMap* b ) {
+	    return a->get_base_address() < b->get_base_address();
+	});
+
+	m_ShadowedMappings.clear();
+
+	for( size_t i = 0; i + 1 < sorted.size(); i++ ) {
+	    const uintptr_t end = (uintptr_t)sorted[i]->get_base_address() + sorted[i]->get_size();
+	    if( (uintptr_t)sorted[i + 1]->get_base_address() < end ) m_ShadowedMappings.insert( sorted[i] );
+	}
+
+	m_LastMappingCandidates = nullptr;
+	m_MappingGeneration++;
 	return true;
 }
 
 MMap* Environment::get_mapping( void* phys_addr, size_t size )
 {
-	if( m_Mappings.empty() ) return nullptr;
+    const uintptr_t chunk = (uintptr_t)phys_addr >> MAPPING_CHUNK_SHIFT;
 
-	auto iter = m_Mappings.upper_bound( phys_addr );
+    if( !m_LastMappingCandidates || chunk != m_LastMappingChunk ) {
+        auto iter = m_MappingTable.find( chunk );
+        if( iter == m_MappingTable.end() ) return nullptr;
 
-	MMap* mmap;
-	if( iter == m_Mappings.begin() ) return nullptr;
-	else if( iter == m_Mappings.end() ) mmap = m_Mappings.rbegin()->second;
-	else mmap = (--iter)->second;
+        m_LastMappingChunk = chunk;
+        m_LastMappingCandidates = &iter->second;
+    }
+
+    // an access is always covered by the chunk of its first byte
+    for( MMap* mmap: *m_LastMappingCandidates ) {
+        if( mmap->contains( phys_addr, size ) ) return mmap;
+    }
 
-	if( (uint8_t*)mmap->get_base_address() + mmap->get_size() < (uint8_t*)phys_addr + size ) return nullptr;
-	else return mmap;
+    return nullptr;
 }
 
-void Environment::enter_subroutine_context( const yylloc_t& location, std::string name, subroutine_type_t type )
+void Environment::enter_subroutine_context( const yylloc_t& location, const std::string& name, subroutine_type_t type )
 {
     assert( m_SubroutineContext == nullptr && m_LocalVars == nullptr && m_LocalArrays == nullptr );
 
-    if( m_BuiltinFunctions->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
-    if( m_BuiltinArrayfuncs->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
+    symbol_t symbol = SymbolTable::intern( name );
+
+    if( m_BuiltinFunctions->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
+    if( m_BuiltinArrayfuncs->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
 
     switch( type ) {
     case PROCEDURE:
-        if( m_FunctionManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
-        if( m_ArrayfuncManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
+        if( m_FunctionManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
+        if( m_ArrayfuncManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
 
         m_SubroutineContext = m_ProcedureManager;
         break;
 
     case FUNCTION:
-    	if( m_ProcedureManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
-        if( m_ArrayfuncManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
+    	if( m_ProcedureManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
+        if( m_ArrayfuncManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
 
     	m_SubroutineContext = m_FunctionManager;
     	break;
 
     case ARRAYFUNC:
-    	if( m_ProcedureManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
-        if( m_FunctionManager->has_subroutine( name ) ) throw ASTExceptionNamingConflict( location, name );
+    	if( m_ProcedureManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
+        if( m_FunctionManager->has_subroutine( symbol ) ) throw ASTExceptionNamingConflict( location, name );
 
     	m_SubroutineContext = m_ArrayfuncManager;
     	break;
     }
 
-    m_SubroutineContext->begin_subroutine( location, name, (type == FUNCTION) ? true : false );
+    m_SubroutineContext->begin_subroutine( location, symbol, (type == FUNCTION) ? true : false );
     m_LocalVars = m_SubroutineContext->get_var_manager();
     m_LocalArrays = m_SubroutineContext->get_array_manager();
 
     if( type == ARRAYFUNC ) set_subroutine_param( "return", true );
 }
 
-void Environment::set_subroutine_param( std::string name, bool is_array )
+void Environment::set_subroutine_param( const std::string& name, bool is_array )
 {
     assert( m_SubroutineContext );
 
-    m_SubroutineContext->set_param( name, is_array );
+    m_SubroutineContext->set_param( SymbolTable::intern( name ), is_array );
 }
 
 void Environment::set_subroutine_body( std::shared_ptr<ASTNode> body  )
@@ -345,24 +461,28 @@ void Environment::commit_subroutine_context( )
     m_LocalArrays = nullptr;
 }
 
-std::shared_ptr<ASTNode> Environment::get_procedure( const yylloc_t& location, std::string name, const arglist_t& args )
+std::shared_ptr<ASTNode> Environment::get_procedure( const yylloc_t& location, const std::string& name, const arglist_t& args )
 {
-    std::shared_ptr<ASTNode> node = m_ProcedureManager->get_subroutine( location, name, args );
+    symbol_t symbol = SymbolTable::intern( name );
+
+    std::shared_ptr<ASTNode> node = m_ProcedureManager->get_subroutine( location, symbol, args );
     if( !node ) throw ASTExceptionNamingConflict( location, name );
     return node;
 }
 
-std::shared_ptr<ASTNode> Environment::get_function( const yylloc_t& location, std::string name, const arglist_t& args )
+std::shared_ptr<ASTNode> Environment::get_function( const yylloc_t& location, const std::string& name, const arglist_t& args )
 {
-    std::shared_ptr<ASTNode> node = m_BuiltinFunctions->get_subroutine( location, name, args );
+    symbol_t symbol = SymbolTable::intern( name );
+
+    std::shared_ptr<ASTNode> node = m_BuiltinFunctions->get_subroutine( location, symbol, args );
     if( node ) return node;
 
-    node = m_FunctionManager->get_subroutine( location, name, args );
+    node = m_FunctionManager->get_subroutine( location, symbol, args );
     if( !node ) throw ASTExceptionNamingConflict( location, name );
     return node;
 }
 
-std::shared_ptr<ASTNode> Environment::get_arrayfunc( const yylloc_t& location, std::string name, std::string ret, const arglist_t& args )
+std::shared_ptr<ASTNode> Environment::get_arrayfunc( const yylloc_t& location, const std::string& name, const std::string& ret, const arglist_t& args )
 {
 	arglist_t retargs;
 	retargs.push_back( make_pair( ASTNode::ptr(nullptr), ret ) );
@@ -372,19 +492,27 @@ std::shared_ptr<ASTNode> Environment::get_arrayfunc( const yylloc_t& location, s
 		if( arg.second == ret ) ret_is_input = true;
 		retargs.push_back( arg );
 	}
-	if( ret_is_input ) retargs[0].second = "@return";
 
-	std::shared_ptr<ASTNode> zero = make_shared<ASTNodeConstant>( location, 0 );
-	std::shared_ptr<ASTNode> init = make_shared<ASTNodeDim>( location, this, retargs[0].second, zero );
+    symbol_t symbol = SymbolTable::intern( name );
+    const bool is_inplace = m_BuiltinArrayfuncs->is_inplace( symbol );
+	if( ret_is_input && !is_inplace ) retargs[0].second = "@return";
 
-    std::shared_ptr<ASTNode> subroutine = m_BuiltinArrayfuncs->get_subroutine( location, name, retargs );
-    if( !subroutine ) subroutine = m_ArrayfuncManager->get_subroutine( location, name, retargs );
+	// in-place builtins resize the return array themselves
+	std::shared_ptr<ASTNode> init;
+	if( !is_inplace ) {
+		std::shared_ptr<ASTNode> zero = make_node<ASTNodeConstant>( location, 0 );
+		init = make_node<ASTNodeDim>( location, this, retargs[0].second, zero );
+	}
+	else if( !alloc_array( ret ) ) throw ASTExceptionNamingConflict( location, ret );
+
+    std::shared_ptr<ASTNode> subroutine = m_BuiltinArrayfuncs->get_subroutine( location, symbol, retargs );
+    if( !subroutine ) subroutine = m_ArrayfuncManager->get_subroutine( location, symbol, retargs );
     if( !subroutine ) throw ASTExceptionNamingConflict( location, name );
 
-	std::shared_ptr<ASTNode> block = make_shared<ASTNodeArrayBlock>( location, this, ret );
-    block->add_child( init );
+	std::shared_ptr<ASTNode> block = make_node<ASTNodeArrayBlock>( location, this, ret );
+    if( init ) block->add_child( init );
     block->add_child( subroutine );
-    if( ret_is_input ) block->add_child( make_shared<ASTNodeAssign>( location, this, ret, retargs[0].second ) );
+    if( ret_is_input && !is_inplace ) block->add_child( make_node<ASTNodeAssign>( location, this, ret, retargs[0].second ) );
 
     return block;
 }
@@ -525,3 +653,23 @@ bool Environment::set_default_modifier( int modifier )
 
     return ret;
 }
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class MappingCache implementation
+//////////////////////////////////////////////////////////////////////////////
+
+MMap* MappingCache::get_block( const yylloc_t& location, void* phys_addr, size_t size, uint64_t count )
+{
+    MMap* mmap = get( phys_addr, size );
+    if( !mmap ) throw ASTExceptionNoMapping( location, phys_addr, size );
+
+    // the whole block must be covered by the mapping of its first element
+    if( count > mmap->get_size() / size || !mmap->contains( phys_addr, count * size ) ) {
+        uint8_t* end = (uint8_t*)mmap->get_base_address() + mmap->get_size();
+        void* unmapped = (uint8_t*)phys_addr + (end - (uint8_t*)phys_addr) / size * size;
+        throw ASTExceptionNoMapping( location, unmapped, size );
+    }
+
+    return mmap;
+}
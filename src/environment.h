@@ -32,15 +32,24 @@
 #include "variables.h"
 #include "arrays.h"
 #include "mmap.h"
-#include "md5.h"
+#include "bytecode.h"
+#include "printbuffer.h"
+#include "tokencache.h"
+#include "tokenizer.h"
 
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <set>
 #include <vector>
 #include <utility>
 #include <memory>
 #include <ostream>
+#include <tuple>
+
+#include <stdint.h>
+#include <sys/types.h>
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -58,50 +67,69 @@ public:
 
     typedef enum { PROCEDURE, FUNCTION, ARRAYFUNC } subroutine_type_t;
 
+    typedef enum { COMPLETION_NORMAL, COMPLETION_BREAK, COMPLETION_EXIT } completion_t;
+
 	Environment();
 	~Environment();
 
 	std::shared_ptr<ASTNode> parse( const char* str, bool is_file, bool run_once );
     std::shared_ptr<ASTNode> parse( const yylloc_t& location, const char* str, bool is_file, bool run_once );
 
+    Bytecode::ptr compile( std::shared_ptr<ASTNode> root );
+
     void set_stdout( std::ostream& out );
 
     std::ostream& get_stdout();
 
+    // output of the print command, flushed by the caller before waiting for input
+    PrintBuffer& get_printbuffer();
+
+    // tokens of the last tokenize() call
+    Tokenizer& get_tokenizer();
+
     bool add_include_path( std::string path );
 
-	var* alloc_var( std::string name );
-	var* alloc_def_var( std::string name );
-    var* alloc_global_var( std::string name );
-    var* alloc_static_var( std::string name );
+    const char* intern_file_name( const std::string& name );
+
+	var* alloc_var( const std::string& name );
+	var* alloc_def_var( const std::string& name );
+    var* alloc_global_var( const std::string& name );
+    var* alloc_static_var( const std::string& name );
 
-	array* alloc_array( std::string name );
-    array* alloc_global_array( std::string name );
-    array* alloc_static_array( std::string name );
-    refarray* alloc_ref_array( std::string name );
+	array* alloc_array( const std::string& name );
+    array* alloc_global_array( const std::string& name );
+    array* alloc_static_array( const std::string& name );
+    refarray* alloc_ref_array( const std::string& name );
 
-	const var* get_var( std::string name );
-	array* get_array( std::string name );
+	const var* get_var( const std::string& name );
+	array* get_array( const std::string& name );
 
-	std::set< std::string > get_autocompletion( std::string prefix );
-	std::set< std::string > get_struct_members( std::string name );
+	std::set< std::string > get_autocompletion( const std::string& prefix );
+	std::set< std::string > get_struct_members( const std::string& name );
 
     bool map_memory( void* phys_addr, void* map_addr, size_t size, std::string device );
 
 	MMap* get_mapping( void* phys_addr, size_t size );
+	unsigned get_mapping_generation();
 
-	void enter_subroutine_context( const yylloc_t& location, std::string name, subroutine_type_t type );
-    void set_subroutine_param( std::string name, bool is_array = false );
+	// true if a mapping with a higher base address overlaps mmap, which is then
+	// not the mapping of all addresses it contains
+	bool is_shadowed_mapping( MMap* mmap );
+
+	void enter_subroutine_context( const yylloc_t& location, const std::string& name, subroutine_type_t type );
+    void set_subroutine_param( const std::string& name, bool is_array = false );
     void set_subroutine_body( std::shared_ptr<ASTNode> body );
     void set_subroutine_varargs();
 	void commit_subroutine_context();
 
-	std::shared_ptr<ASTNode> get_procedure( const yylloc_t& location, std::string name, const arglist_t& args );
-    std::shared_ptr<ASTNode> get_function( const yylloc_t& location, std::string name, const arglist_t& args );
-    std::shared_ptr<ASTNode> get_arrayfunc( const yylloc_t& location, std::string name, std::string ret, const arglist_t& args );
+	std::shared_ptr<ASTNode> get_procedure( const yylloc_t& location, const std::string& name, const arglist_t& args );
+    std::shared_ptr<ASTNode> get_function( const yylloc_t& location, const std::string& name, const arglist_t& args );
+    std::shared_ptr<ASTNode> get_arrayfunc( const yylloc_t& location, const std::string& name, const std::string& ret, const arglist_t& args );
+
+    bool drop_procedure( const std::string& name );
+    bool drop_function( const std::string& name );
 
-    bool drop_procedure( std::string name );
-    bool drop_function( std::string name );
+    bool memoize_function( const yylloc_t& location, const std::string& name );
 
     int get_default_size();
     bool set_default_size( int size );
@@ -126,6 +154,9 @@ public:
     void clear_terminate();
     bool is_terminated();
 
+    void set_completion( completion_t completion );
+    completion_t get_completion();
+
     static uint64_t parse_int( std::string str );
     static uint64_t parse_int( std::string str, bool& is_ok );
     static uint64_t parse_float( std::string str );
@@ -135,11 +166,24 @@ private:
     void register_float_functions( BuiltinManager* manager );
     void register_string_functions( BuiltinManager* manager );
     void register_string_arrayfuncs( BuiltinManager* manager );
+    void register_array_functions( BuiltinManager* manager );
+    void register_array_arrayfuncs( BuiltinManager* manager );
+    void register_checksum_functions( BuiltinManager* manager );
 
     VarManager* m_GlobalVars;
     ArrayManager* m_GlobalArrays;
 
-	std::map< void*, MMap* > m_Mappings;
+	// mappings are indexed by chunks of 2^MAPPING_CHUNK_SHIFT bytes, each chunk lists
+	// all mappings overlapping it in order of descending base address
+	static const unsigned MAPPING_CHUNK_SHIFT = 16;
+
+	std::vector< MMap* > m_Mappings;
+	std::unordered_map< uintptr_t, std::vector< MMap* > > m_MappingTable;
+	unsigned m_MappingGeneration = 1;
+	std::unordered_set< MMap* > m_ShadowedMappings;
+
+	uintptr_t m_LastMappingChunk = 0;
+	const std::vector< MMap* >* m_LastMappingCandidates = nullptr;
 
 	BuiltinManager* m_BuiltinFunctions;
 	BuiltinManager* m_BuiltinArrayfuncs;
@@ -153,7 +197,15 @@ private:
     ArrayManager* m_LocalArrays = nullptr;
 
 	std::vector< std::string > m_IncludePaths;
-	std::set< MD5 > m_ImportedFiles;
+	// imported files by content hash, (device, inode, size, mtime) of a file
+	// maps to its content hash to skip unchanged files without reading them
+	typedef std::tuple< dev_t, ino_t, off_t, time_t, long > fileid_t;
+	std::set< uint64_t > m_ImportedFiles;
+	std::map< fileid_t, uint64_t > m_ImportedFileIds;
+	TokenCache m_TokenCache;
+
+	// file names referenced by source locations, never removed
+	std::unordered_set< std::string > m_FileNames;
 
 	int m_DefaultSize;
 	std::stack<int> m_DefaultSizeStack;
@@ -165,7 +217,39 @@ private:
 
     volatile sig_atomic_t m_IsTerminated;
 
+    completion_t m_Completion;
+
     std::ostream* m_Stdout;
+
+    PrintBuffer m_PrintBuffer;
+
+    Tokenizer m_Tokenizer;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class MappingCache
+//////////////////////////////////////////////////////////////////////////////
+
+// remembers the mapping of the last access of a peek or poke node, the
+// mapping generation of the environment invalidates it after each map.
+// Shadowed mappings are not remembered, a nested mapping takes precedence
+// for a part of their addresses
+class MappingCache {
+public:
+    MappingCache( Environment* env );
+
+    MMap* get( void* phys_addr, size_t size );
+
+    // mapping of a block of count elements with size bytes each, throws if the
+    // block is not covered by the mapping of its first element
+    MMap* get_block( const yylloc_t& location, void* phys_addr, size_t size, uint64_t count );
+
+private:
+    Environment* m_Env;
+
+    MMap* m_Mapping = nullptr;
+    unsigned m_Generation = 0;
 };
 
 
@@ -173,9 +257,20 @@ private:
 // class Environment inline functions
 //////////////////////////////////////////////////////////////////////////////
 
+inline unsigned Environment::get_mapping_generation()
+{
+    return m_MappingGeneration;
+}
+
+inline bool Environment::is_shadowed_mapping( MMap* mmap )
+{
+    return m_ShadowedMappings.count( mmap ) != 0;
+}
+
 inline void Environment::set_stdout( std::ostream& out )
 {
     m_Stdout = &out;
+    m_PrintBuffer.set_stream( out );
 }
 
 inline std::ostream& Environment::get_stdout()
@@ -183,75 +278,99 @@ inline std::ostream& Environment::get_stdout()
     return *m_Stdout;
 }
 
-inline Environment::var* Environment::alloc_def_var( std::string name )
+inline PrintBuffer& Environment::get_printbuffer()
+{
+    return m_PrintBuffer;
+}
+
+inline Tokenizer& Environment::get_tokenizer()
+{
+    return m_Tokenizer;
+}
+
+inline Environment::var* Environment::alloc_def_var( const std::string& name )
 {
-    return m_GlobalVars->alloc_def( name );
+    return m_GlobalVars->alloc_def( SymbolTable::intern( name ) );
 }
 
-inline Environment::var* Environment::alloc_var( std::string name )
+inline Environment::var* Environment::alloc_var( const std::string& name )
 {
+    symbol_t symbol = SymbolTable::intern( name );
+
     if( m_LocalVars ) {
-        const Environment::var* var = m_GlobalVars->get( name );
+        const Environment::var* var = m_GlobalVars->get( symbol );
         if( var && var->is_def() ) return nullptr;
-        return m_LocalVars->alloc_local( name );
+        return m_LocalVars->alloc_local( symbol );
     }
-    else return m_GlobalVars->alloc_global( name );
+    else return m_GlobalVars->alloc_global( symbol );
 }
 
-inline Environment::var* Environment::alloc_global_var( std::string name )
+inline Environment::var* Environment::alloc_global_var( const std::string& name )
 {
-    Environment::var* var = m_GlobalVars->alloc_global( name );
+    symbol_t symbol = SymbolTable::intern( name );
+    Environment::var* var = m_GlobalVars->alloc_global( symbol );
 
-    if( var && m_LocalVars ) return m_LocalVars->alloc_delegate( name, var );
+    if( var && m_LocalVars ) return m_LocalVars->alloc_delegate( symbol, var );
     else return var;
 }
 
-inline Environment::var* Environment::alloc_static_var( std::string name )
+inline Environment::var* Environment::alloc_static_var( const std::string& name )
 {
-    if( m_LocalVars ) return m_LocalVars->alloc_global( name );
-    else return m_GlobalVars->alloc_global( name );
+    if( m_LocalVars ) return m_LocalVars->alloc_global( SymbolTable::intern( name ) );
+    else return m_GlobalVars->alloc_global( SymbolTable::intern( name ) );
 }
 
-inline Environment::array* Environment::alloc_array( std::string name )
+inline Environment::array* Environment::alloc_array( const std::string& name )
 {
-    if( m_LocalArrays ) return m_LocalArrays->alloc_local( name );
-    else return m_GlobalArrays->alloc_global( name );
+    if( m_LocalArrays ) return m_LocalArrays->alloc_local( SymbolTable::intern( name ) );
+    else return m_GlobalArrays->alloc_global( SymbolTable::intern( name ) );
 }
 
-inline Environment::array* Environment::alloc_global_array( std::string name )
+inline Environment::array* Environment::alloc_global_array( const std::string& name )
 {
-    Environment::array* array = m_GlobalArrays->alloc_global( name );
+    symbol_t symbol = SymbolTable::intern( name );
+    Environment::array* array = m_GlobalArrays->alloc_global( symbol );
 
-    if( array && m_LocalArrays ) return m_LocalArrays->alloc_delegate( name, array );
+    if( array && m_LocalArrays ) return m_LocalArrays->alloc_delegate( symbol, array );
     else return array;
 }
 
-inline Environment::array* Environment::alloc_static_array( std::string name )
+inline Environment::array* Environment::alloc_static_array( const std::string& name )
 {
-    if( m_LocalArrays ) return m_LocalArrays->alloc_global( name );
-    else return m_GlobalArrays->alloc_global( name );
+    if( m_LocalArrays ) return m_LocalArrays->alloc_global( SymbolTable::intern( name ) );
+    else return m_GlobalArrays->alloc_global( SymbolTable::intern( name ) );
 }
 
-inline Environment::refarray* Environment::alloc_ref_array( std::string name )
+inline Environment::refarray* Environment::alloc_ref_array( const std::string& name )
 {
-    if( m_LocalArrays ) return m_LocalArrays->alloc_ref( name );
-    else return m_GlobalArrays->alloc_ref( name );
+    if( m_LocalArrays ) return m_LocalArrays->alloc_ref( SymbolTable::intern( name ) );
+    else return m_GlobalArrays->alloc_ref( SymbolTable::intern( name ) );
 }
 
-inline std::set< std::string > Environment::get_struct_members( std::string name )
+inline std::set< std::string > Environment::get_struct_members( const std::string& name )
 {
-    return m_GlobalVars->get_struct_members( name );
+    return m_GlobalVars->get_struct_members( SymbolTable::intern( name ) );
 }
 
-inline bool Environment::drop_procedure( std::string name )
+inline bool Environment::drop_procedure( const std::string& name )
 {
-    return m_ProcedureManager->drop_subroutine( name );
+    return m_ProcedureManager->drop_subroutine( SymbolTable::intern( name ) );
 }
 
-inline bool Environment::drop_function( std::string name )
+inline bool Environment::drop_function( const std::string& name )
 {
-    if( m_FunctionManager->drop_subroutine( name ) ) return true;
-    else return m_ArrayfuncManager->drop_subroutine( name );
+    symbol_t symbol = SymbolTable::intern( name );
+
+    if( m_FunctionManager->drop_subroutine( symbol ) ) return true;
+    else return m_ArrayfuncManager->drop_subroutine( symbol );
+}
+
+inline bool Environment::memoize_function( const yylloc_t& location, const std::string& name )
+{
+    symbol_t symbol = SymbolTable::intern( name );
+
+    if( m_FunctionManager->memoize_subroutine( location, symbol ) ) return true;
+    else return m_ArrayfuncManager->memoize_subroutine( location, symbol );
 }
 
 inline void Environment::set_terminate()
@@ -269,6 +388,16 @@ inline bool Environment::is_terminated()
     return m_IsTerminated == 1;
 }
 
+inline void Environment::set_completion( completion_t completion )
+{
+    m_Completion = completion;
+}
+
+inline Environment::completion_t Environment::get_completion()
+{
+    return m_Completion;
+}
+
 inline uint64_t Environment::parse_int( std::string str )
 {
     bool dummy = false;
@@ -353,4 +482,25 @@ inline void Environment::pop_varargs()
 }
 
 
+
+//////////////////////////////////////////////////////////////////////////////
+// class MappingCache inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline MappingCache::MappingCache( Environment* env )
+ : m_Env( env )
+{}
+
+inline MMap* MappingCache::get( void* phys_addr, size_t size )
+{
+    if( m_Generation != m_Env->get_mapping_generation() || !m_Mapping || !m_Mapping->contains( phys_addr, size ) ) {
+        MMap* mmap = m_Env->get_mapping( phys_addr, size );
+        m_Mapping = m_Env->is_shadowed_mapping( mmap ) ? nullptr : mmap;
+        m_Generation = m_Env->get_mapping_generation();
+        return mmap;
+    }
+
+    return m_Mapping;
+}
+
 #endif // __environment_h__
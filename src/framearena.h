@@ -0,0 +1,160 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __framearena_h__
+#define __framearena_h__
+
+#include <vector>
+#include <algorithm>
+
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class FrameArena
+//////////////////////////////////////////////////////////////////////////////
+
+// Stack of value initialized elements for subroutine frames. Allocation is a
+// pointer bump in the current block, release() drops everything allocated
+// after a mark. Blocks are kept for reuse and never move, so pointers stay
+// valid until they are released.
+
+template< typename T >
+class FrameArena {
+public:
+    typedef struct {
+        size_t block;
+        T* top;
+    } mark_t;
+
+    FrameArena( size_t block_size );
+    ~FrameArena();
+
+    T* alloc( size_t size );
+
+    // grows or shrinks the most recent allocation in place, if possible
+    bool resize( T* ptr, size_t old_size, size_t new_size );
+
+    mark_t get_mark() const;
+    void release( mark_t mark );
+
+private:
+    typedef struct {
+        T* begin;
+        T* end;
+    } block_t;
+
+    T* alloc_block( size_t size );
+
+    size_t m_BlockSize;
+
+    std::vector< block_t > m_Blocks;
+    size_t m_Block = 0;
+    T* m_Top = nullptr;
+    T* m_End = nullptr;
+
+    FrameArena( const FrameArena& ) = delete;
+    FrameArena& operator=( const FrameArena& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class FrameArena template functions
+//////////////////////////////////////////////////////////////////////////////
+
+template< typename T >
+inline FrameArena< T >::FrameArena( size_t block_size )
+ : m_BlockSize( block_size )
+{}
+
+template< typename T >
+inline FrameArena< T >::~FrameArena()
+{
+    for( auto& block: m_Blocks ) delete[] block.begin;
+}
+
+template< typename T >
+inline T* FrameArena< T >::alloc( size_t size )
+{
+    T* ptr = m_Top;
+
+    if( (size_t)(m_End - m_Top) >= size ) m_Top += size;
+    else ptr = alloc_block( size );
+
+    std::fill( ptr, ptr + size, T() );
+    return ptr;
+}
+
+template< typename T >
+inline bool FrameArena< T >::resize( T* ptr, size_t old_size, size_t new_size )
+{
+    if( ptr + old_size != m_Top || (size_t)(m_End - ptr) < new_size ) return false;
+
+    m_Top = ptr + new_size;
+    if( new_size > old_size ) std::fill( ptr + old_size, m_Top, T() );
+    return true;
+}
+
+template< typename T >
+inline typename FrameArena< T >::mark_t FrameArena< T >::get_mark() const
+{
+    return { m_Block, m_Top };
+}
+
+template< typename T >
+inline void FrameArena< T >::release( mark_t mark )
+{
+    m_Block = mark.block;
+    m_Top = mark.top;
+    m_End = m_Top ? m_Blocks[ m_Block ].end : nullptr;
+}
+
+template< typename T >
+T* FrameArena< T >::alloc_block( size_t size )
+{
+    // the current block is left partly unused, release() returns to it
+    size_t next = m_Top ? m_Block + 1 : m_Block;
+
+    while( next < m_Blocks.size() && (size_t)(m_Blocks[ next ].end - m_Blocks[ next ].begin) < size ) {
+        // too small for this frame, replace it
+        delete[] m_Blocks[ next ].begin;
+        m_Blocks.erase( m_Blocks.begin() + next );
+    }
+
+    if( next == m_Blocks.size() ) {
+        size_t block_size = std::max( size, m_BlockSize );
+        T* begin = new T[ block_size ];
+        m_Blocks.push_back( { begin, begin + block_size } );
+    }
+
+    m_Block = next;
+    m_Top = m_Blocks[ next ].begin + size;
+    m_End = m_Blocks[ next ].end;
+
+    return m_Blocks[ next ].begin;
+}
+
+
+#endif // __framearena_h__
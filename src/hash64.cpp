@@ -0,0 +1,123 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "hash64.h"
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// 64 bit hash implementation
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const uint64_t PRIME1 = 0x9e3779b185ebca87ULL;
+const uint64_t PRIME2 = 0xc2b2ae3d27d4eb4fULL;
+const uint64_t PRIME3 = 0x165667b19e3779f9ULL;
+const uint64_t PRIME4 = 0x85ebca77c2b2ae63ULL;
+const uint64_t PRIME5 = 0x27d4eb2f165667c5ULL;
+
+inline uint64_t rotl( uint64_t value, int bits )
+{
+    return ( value << bits ) | ( value >> ( 64 - bits ) );
+}
+
+inline uint64_t read64( const uint8_t* p )
+{
+    uint64_t value;
+    memcpy( &value, p, sizeof( value ) );
+    return value;
+}
+
+inline uint32_t read32( const uint8_t* p )
+{
+    uint32_t value;
+    memcpy( &value, p, sizeof( value ) );
+    return value;
+}
+
+inline uint64_t round( uint64_t acc, uint64_t input )
+{
+    acc += input * PRIME2;
+    acc = rotl( acc, 31 );
+    return acc * PRIME1;
+}
+
+inline uint64_t merge( uint64_t hash, uint64_t acc )
+{
+    hash ^= round( 0, acc );
+    return hash * PRIME1 + PRIME4;
+}
+
+}
+
+uint64_t hash64( const void* data, size_t size, uint64_t seed )
+{
+    const uint8_t* p = static_cast< const uint8_t* >( data );
+    const uint8_t* end = p + size;
+    uint64_t hash;
+
+    if( size >= 32 ) {
+        uint64_t acc[4] = { seed + PRIME1 + PRIME2, seed + PRIME2, seed, seed - PRIME1 };
+
+        for( const uint8_t* last = end - 32; p <= last; p += 32 ) {
+            acc[0] = round( acc[0], read64( p ) );
+            acc[1] = round( acc[1], read64( p + 8 ) );
+            acc[2] = round( acc[2], read64( p + 16 ) );
+            acc[3] = round( acc[3], read64( p + 24 ) );
+        }
+
+        hash = rotl( acc[0], 1 ) + rotl( acc[1], 7 ) + rotl( acc[2], 12 ) + rotl( acc[3], 18 );
+        for( uint64_t a: acc ) hash = merge( hash, a );
+    }
+    else hash = seed + PRIME5;
+
+    hash += size;
+
+    for( ; p + 8 <= end; p += 8 ) {
+        hash ^= round( 0, read64( p ) );
+        hash = rotl( hash, 27 ) * PRIME1 + PRIME4;
+    }
+
+    if( p + 4 <= end ) {
+        hash ^= read32( p ) * PRIME1;
+        hash = rotl( hash, 23 ) * PRIME2 + PRIME3;
+        p += 4;
+    }
+
+    for( ; p < end; p++ ) {
+        hash ^= *p * PRIME5;
+        hash = rotl( hash, 11 ) * PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
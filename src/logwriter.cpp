@@ -0,0 +1,149 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "logwriter.h"
+
+#include <algorithm>
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class LogWriter implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogWriter::LogWriter( const char* file, bool append )
+ : m_Queue( new char[ QUEUE_SIZE ] ),
+   m_Head( 0 ),
+   m_Tail( 0 ),
+   m_IsWaiting( false ),
+   m_IsClosing( false )
+{
+    m_File = open( file, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0666 );
+
+    if( m_File >= 0 ) m_Thread = thread( &LogWriter::run, this );
+}
+
+LogWriter::~LogWriter()
+{
+    if( m_File >= 0 ) {
+        m_IsClosing = true;
+        wakeup();
+        m_Thread.join();
+
+        close( m_File );
+    }
+}
+
+LogWriter::int_type LogWriter::overflow( int_type ch )
+{
+    if( traits_type::eq_int_type( ch, traits_type::eof() ) ) return traits_type::not_eof( ch );
+
+    char c = traits_type::to_char_type( ch );
+    push( &c, 1 );
+
+    return ch;
+}
+
+std::streamsize LogWriter::xsputn( const char* s, std::streamsize n )
+{
+    push( s, n );
+
+    return n;
+}
+
+void LogWriter::push( const char* data, size_t len )
+{
+    if( m_File < 0 ) return;
+
+    while( len > 0 ) {
+        const size_t head = m_Head.load( memory_order_relaxed );
+        const size_t space = QUEUE_SIZE - (head - m_Tail.load( memory_order_acquire ));
+
+        if( space == 0 ) {
+            // back-pressure: the background thread is busy with the full queue
+            this_thread::yield();
+            continue;
+        }
+
+        const size_t n = min( len, space );
+        const size_t pos = head % QUEUE_SIZE;
+        const size_t n1 = min( n, QUEUE_SIZE - pos );
+
+        memcpy( m_Queue.get() + pos, data, n1 );
+        memcpy( m_Queue.get(), data + n1, n - n1 );
+
+        m_Head.store( head + n );
+        wakeup();
+
+        data += n;
+        len -= n;
+    }
+}
+
+void LogWriter::wakeup()
+{
+    // m_IsWaiting is set with m_Mutex held, locking the mutex here makes sure
+    // that the background thread is already waiting for the notification
+    if( m_IsWaiting ) {
+        lock_guard< mutex > lock( m_Mutex );
+        m_Wakeup.notify_one();
+    }
+}
+
+void LogWriter::run()
+{
+    for(;;) {
+        const size_t tail = m_Tail.load( memory_order_relaxed );
+        const size_t head = m_Head.load( memory_order_acquire );
+
+        if( head != tail ) {
+            const size_t pos = tail % QUEUE_SIZE;
+            const size_t n = min( head - tail, QUEUE_SIZE - pos );
+
+            for( size_t done = 0; done < n; ) {
+                ssize_t ret = write( m_File, m_Queue.get() + pos + done, n - done );
+                if( ret > 0 ) done += ret;
+                else if( ret < 0 && errno == EINTR ) continue;
+                else break; // write errors drop the data, the program must not block
+            }
+
+            m_Tail.store( tail + n, memory_order_release );
+            continue;
+        }
+
+        if( m_IsClosing && m_Head == tail ) break;
+
+        unique_lock< mutex > lock( m_Mutex );
+        m_IsWaiting = true;
+        while( m_Head == tail && !m_IsClosing ) m_Wakeup.wait( lock );
+        m_IsWaiting = false;
+    }
+}
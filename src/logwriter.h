@@ -0,0 +1,102 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __logwriter_h__
+#define __logwriter_h__
+
+#include <streambuf>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class LogWriter
+//////////////////////////////////////////////////////////////////////////////
+
+// streambuf for the log file. The output is passed through a lock-free ring
+// buffer to a background thread which writes it to the file, so the program
+// does not wait for the file system. Only one thread may write to a LogWriter.
+//
+// - when the ring buffer is full, the writing thread waits until the background
+//   thread has made room, no output is dropped
+// - sync() does not wait, the data is written as soon as possible
+// - the destructor writes all pending data before the file is closed
+class LogWriter : public std::streambuf {
+public:
+    LogWriter( const char* file, bool append );
+    ~LogWriter();
+
+    bool is_open() const;
+
+protected:
+    int_type overflow( int_type ch ) override;
+    std::streamsize xsputn( const char* s, std::streamsize n ) override;
+
+private:
+    static const size_t QUEUE_SIZE = 1 << 20;
+
+    void push( const char* data, size_t len );
+    void wakeup();
+
+    void run();
+
+    int m_File;
+
+    std::unique_ptr< char[] > m_Queue;
+
+    // positions increase monotonically, m_Head is written by the producer and
+    // m_Tail by the background thread
+    std::atomic< size_t > m_Head;
+    std::atomic< size_t > m_Tail;
+
+    std::atomic< bool > m_IsWaiting;
+    std::atomic< bool > m_IsClosing;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Wakeup;
+
+    std::thread m_Thread;
+
+    LogWriter( const LogWriter& ) = delete;
+    LogWriter& operator=( const LogWriter& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class LogWriter inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline bool LogWriter::is_open() const
+{
+    return m_File >= 0;
+}
+
+
+#endif // __logwriter_h__
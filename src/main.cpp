@@ -27,6 +27,7 @@
 #include "mempeek_exceptions.h"
 #include "console.h"
 #include "teestream.h"
+#include "logwriter.h"
 #include "version.h"
 
 #if defined( YYDEBUG ) && YYDEBUG != 0
@@ -35,7 +36,6 @@
 #endif
 
 #include <iostream>
-#include <fstream>
 
 #include <string.h>
 #include <signal.h>
@@ -59,6 +59,7 @@ static void signal_handler( int )
 static void parse( Environment* env, const char* str, bool is_file )
 {
     env->clear_terminate();
+    env->set_completion( Environment::COMPLETION_NORMAL );
     signal( SIGABRT, signal_handler );
     signal( SIGINT, signal_handler );
     signal( SIGTERM, signal_handler );
@@ -66,27 +67,30 @@ static void parse( Environment* env, const char* str, bool is_file )
     try {
         ASTNode::ptr yyroot = env->parse( str, is_file, false );
 
+        Bytecode::ptr bytecode = env->compile( yyroot );
+
 #ifdef ASTDEBUG
 		cerr << "executing ASTNode[" << yyroot << "]" << endl;
 #endif
-		yyroot->execute();
-    }
-    catch( ASTExceptionExit& ) {
-        // nothing to do
-    }
-    catch( ASTExceptionBreak& ) {
-        // nothing to do
+		bytecode->execute();
+
+		env->get_printbuffer().flush();
     }
     catch( ASTExceptionTerminate& ) {
+        env->get_printbuffer().flush();
         cout << endl << "terminated execution" << endl;
     }
     catch( const ASTCompileException& ex ) {
+        env->get_printbuffer().flush();
         cerr << ex.get_location() << "compile error: " << ex.what() << endl;
     }
     catch( const ASTRuntimeException& ex ) {
+        env->get_printbuffer().flush();
         cerr << ex.get_location() << "runtime error: " << ex.what() << endl;
     }
     catch( ... ) {
+        env->get_printbuffer().flush();
+
         signal( SIGABRT, SIG_DFL );
         signal( SIGINT, SIG_DFL );
         signal( SIGTERM, SIG_DFL );
@@ -110,6 +114,7 @@ static void print_usage( const char* name )
             "    -a <value>  Append value to script arguments\n"
             "    -l <file>   Write output and interactive input to <file>\n"
             "    -ll <file>  Append output and interactive input to <file>\n"
+            "    -u          Flush output after each line, default if stdout is a terminal\n"
             "    -v          Print version\n"
             "    -h          Print usage\n"
          << flush;
@@ -224,13 +229,15 @@ int main( int argc, char** argv )
 
     MMap::enable_signal_handler();
 
-    ofstream* logfile = nullptr;
+    LogWriter* logfile = nullptr;
     basic_teebuf< char >* cout_buf = nullptr;
     basic_teebuf< char >* cerr_buf = nullptr;
 
     Environment env;
     MP_ENV = &env;
 
+    env.get_printbuffer().set_line_buffered( isatty( STDOUT_FILENO ) );
+
     try {
         bool is_interactive = false;
         bool has_commands = false;
@@ -257,6 +264,7 @@ int main( int argc, char** argv )
                 throw ASTExceptionQuit();
             }
             else if( strcmp( argv[i], "-i" ) == 0 ) is_interactive = true;
+            else if( strcmp( argv[i], "-u" ) == 0 ) env.get_printbuffer().set_line_buffered( true );
             else if( strcmp( argv[i], "-I" ) == 0 ) {
                 if( ++i >= argc ) {
                     cerr << "missing include path" << endl;
@@ -300,17 +308,20 @@ int main( int argc, char** argv )
                     throw ASTExceptionQuit();
                 }
 
-                if( strcmp( argv[ i - 1 ], "-l" ) == 0 ) logfile = new ofstream( argv[i] );
-                else logfile = new ofstream( argv[i], ios::app );
+                logfile = new LogWriter( argv[i], strcmp( argv[ i - 1 ], "-ll" ) == 0 );
+                if( !logfile->is_open() ) {
+                    cerr << "could not open log file" << endl;
+                    throw ASTExceptionQuit();
+                }
 
                 cout_buf = new basic_teebuf<char>;
                 cout_buf->attach( cout.rdbuf() );
-                cout_buf->attach( logfile->rdbuf() );
+                cout_buf->attach( logfile );
                 cout.rdbuf( cout_buf );
 
                 cerr_buf = new basic_teebuf<char>;
                 cerr_buf->attach( cerr.rdbuf() );
-                cerr_buf->attach( logfile->rdbuf() );
+                cerr_buf->attach( logfile );
                 cerr.rdbuf( cerr_buf );
             }
             else {
@@ -328,7 +339,10 @@ int main( int argc, char** argv )
             if( !has_commands ) print_release_info();
             for(;;) {
                 string line = console.get_line();
-                if( logfile ) *logfile << "> " << line;
+                if( logfile ) {
+                    string echo = "> " + line;
+                    logfile->sputn( echo.data(), echo.length() );
+                }
                 parse( &env, line.c_str(), false );
             }
         }
@@ -338,8 +352,10 @@ int main( int argc, char** argv )
     }
 
     if( logfile ) {
-        cout_buf->detach( logfile->rdbuf() );
-        cerr_buf->detach( logfile->rdbuf() );
+        // detach() flushes the tee buffers, deleting the log writer waits until
+        // the background thread has written all pending output
+        if( cout_buf ) cout_buf->detach( logfile );
+        if( cerr_buf ) cerr_buf->detach( logfile );
         delete logfile;
         // teebuffers are not deleted because cout/cerr still use them
     }
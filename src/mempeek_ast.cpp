@@ -35,6 +35,7 @@
 #include <list>
 
 #include <stdio.h>
+#include <string.h>
 #include <ctype.h>
 #include <time.h>
 #include <assert.h>
@@ -43,12 +44,43 @@
 using namespace std;
 
 
+//////////////////////////////////////////////////////////////////////////////
+// helper functions
+//////////////////////////////////////////////////////////////////////////////
+
+static uint64_t get_monotonic_time()
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void resolve_mapping( MappingCache& mapping, ASTNode::ptr address, int size_restriction )
+{
+    // constant addresses are resolved while parsing, the cache still revalidates
+    // the mapping on each access in case a later map statement changes it
+    if( !address->is_constant() ) return;
+
+    size_t size;
+    switch( size_restriction ) {
+    case T_8BIT: size = sizeof(uint8_t); break;
+    case T_16BIT: size = sizeof(uint16_t); break;
+    case T_32BIT: size = sizeof(uint32_t); break;
+    default: size = sizeof(uint64_t); break;
+    }
+
+    // constant children are folded to ASTNodeConstant by add_child()
+    mapping.get( (void*)address->execute(), size );
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNode implementation
 //////////////////////////////////////////////////////////////////////////////
 
 ASTNode::ASTNode( const yylloc_t& yylloc )
- : m_Location( yylloc )
+ : m_Location( yylloc ),
+   m_Children( ASTArena::get_current() )
 {}
 
 ASTNode::~ASTNode()
@@ -63,11 +95,66 @@ bool ASTNode::get_array_result( Environment::array*& array )
     return false;
 }
 
+Bytecode::reg_t ASTNode::compile( Bytecode& code )
+{
+    // nodes without a dedicated instruction are executed by the interpreter
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_node( Bytecode::OP_EXEC, ret, 0, 0, this );
+    return ret;
+}
+
+uint64_t ASTNode::call( uint64_t* )
+{
+    // must never happen
+    assert( false );
+    return 0;
+}
+
 ASTNode::ptr ASTNode::clone_to_const()
 {
     return nullptr;
 }
 
+bool ASTNode::is_pure()
+{
+    return false;
+}
+
+bool ASTNode::is_bounded()
+{
+    for( const ASTNode::ptr& node: m_Children ) {
+        if( !node->is_bounded() ) return false;
+    }
+
+    return true;
+}
+
+bool ASTNode::has_pure_children()
+{
+    for( const ASTNode::ptr& node: m_Children ) {
+        if( !node->is_pure() ) return false;
+    }
+
+    return true;
+}
+
+Bytecode::reg_t ASTNode::compile_call( Bytecode& code )
+{
+    const Bytecode::reg_t base = code.get_top();
+
+    for( size_t i = 0; i < m_Children.size(); i++ ) {
+        Bytecode::reg_t reg = m_Children[i]->compile( code );
+        code.pop_regs( base + i );
+        Bytecode::reg_t arg = code.push_reg();
+        if( reg != arg ) code.emit( Bytecode::OP_MOVE, arg, reg );
+    }
+
+    code.pop_regs( base );
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_node( Bytecode::OP_CALL, ret, base, 0, this );
+    return ret;
+}
+
 uint64_t ASTNode::compiletime_execute( ASTNode* node )
 {
     if( !node->is_constant() ) throw ASTExceptionNonconstExpression( node->get_location() );
@@ -84,8 +171,9 @@ uint64_t ASTNode::compiletime_execute( ASTNode* node )
 // class ASTNodeBreak
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodeBreak::ASTNodeBreak( const yylloc_t& yylloc, int token )
+ASTNodeBreak::ASTNodeBreak( const yylloc_t& yylloc, Environment* env, int token )
  : ASTNode( yylloc ),
+   m_Env( env ),
    m_Token( token )
 {
 #ifdef ASTDEBUG
@@ -100,14 +188,34 @@ uint64_t ASTNodeBreak::execute()
 #endif
 
     switch( m_Token ) {
-    case T_EXIT: throw ASTExceptionExit();
-    case T_BREAK: throw ASTExceptionBreak();
+    case T_EXIT: m_Env->set_completion( Environment::COMPLETION_EXIT ); break;
+    case T_BREAK: m_Env->set_completion( Environment::COMPLETION_BREAK ); break;
     case T_QUIT: throw ASTExceptionQuit();
     }
 
     return 0;
 }
 
+Bytecode::reg_t ASTNodeBreak::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeBreak" << endl;
+#endif
+
+    switch( m_Token ) {
+    case T_EXIT: code.emit_exit(); break;
+    case T_BREAK: code.emit_break(); break;
+    case T_QUIT: code.emit( Bytecode::OP_QUIT ); break;
+    }
+
+    return code.push_reg();
+}
+
+bool ASTNodeBreak::is_pure()
+{
+    return m_Token != T_QUIT;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeBlock implementation
@@ -131,11 +239,57 @@ uint64_t ASTNodeBlock::execute()
 	for( ASTNode::ptr node: get_children() ) {
 	    node->execute();
         if( m_Env->is_terminated() ) throw ASTExceptionTerminate();
+        if( m_Env->get_completion() != Environment::COMPLETION_NORMAL ) break;
 	}
 
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeBlock::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeBlock" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    for( const ASTNode::ptr& node: get_children() ) {
+        node->compile( code );
+        code.pop_regs( top );
+        code.emit( Bytecode::OP_CHECK_TERMINATE );
+    }
+
+    return code.push_reg();
+}
+
+Bytecode* ASTNodeBlock::get_bytecode()
+{
+    if( !m_Bytecode ) {
+        Bytecode::ptr bytecode = make_shared<Bytecode>( m_Env );
+        bytecode->compile( this );
+        m_Bytecode = bytecode;
+    }
+
+    return m_Bytecode.get();
+}
+
+bool ASTNodeBlock::is_pure()
+{
+    switch( m_Purity ) {
+    case PURITY_UNKNOWN:
+        m_Purity = PURITY_ANALYZING;
+        m_Purity = has_pure_children() ? PURITY_PURE : PURITY_IMPURE;
+        return m_Purity == PURITY_PURE;
+
+    case PURITY_ANALYZING:
+    case PURITY_PURE:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeArrayBlock implementation
@@ -163,6 +317,7 @@ uint64_t ASTNodeArrayBlock::execute()
 	for( ASTNode::ptr node: get_children() ) {
 	    node->execute();
         if( m_Env->is_terminated() ) throw ASTExceptionTerminate();
+        if( m_Env->get_completion() != Environment::COMPLETION_NORMAL ) break;
 	}
 
 	return 0;
@@ -174,6 +329,25 @@ bool ASTNodeArrayBlock::get_array_result( Environment::array*& array )
     return true;
 }
 
+Bytecode::reg_t ASTNodeArrayBlock::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeArrayBlock" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    for( const ASTNode::ptr& node: get_children() ) {
+        node->compile( code );
+        code.pop_regs( top );
+        code.emit( Bytecode::OP_CHECK_TERMINATE );
+    }
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_value( Bytecode::OP_CONST, ret, 0, 0, 0 );
+    return ret;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeSubroutine implementation
@@ -182,7 +356,8 @@ bool ASTNodeArrayBlock::get_array_result( Environment::array*& array )
 ASTNodeSubroutine::ASTNodeSubroutine( const yylloc_t& yylloc, std::weak_ptr<ASTNode> body,
                                       Environment* env, VarManager* vars, ArrayManager* arrays,
                                       std::vector< SubroutineManager::param_t >& params,
-                                      size_t num_varargs, Environment::var* retval )
+                                      size_t num_varargs, Environment::var* retval,
+                                      std::shared_ptr< SubroutineManager::memo_t > memo )
  : ASTNode( yylloc ),
    m_Env( env ),
    m_LocalVars( vars ),
@@ -190,7 +365,8 @@ ASTNodeSubroutine::ASTNodeSubroutine( const yylloc_t& yylloc, std::weak_ptr<ASTN
    m_Params( params ),
    m_NumVarargs( num_varargs ),
    m_Retval( retval ),
-   m_Body( body )
+   m_Body( body ),
+   m_Memo( memo )
 {
 #ifdef ASTDEBUG
     cerr << "AST[" << this << "]: creating ASTNodeSubroutine num_varargs=" << num_varargs << endl;
@@ -203,6 +379,169 @@ uint64_t ASTNodeSubroutine::execute()
     cerr << "AST[" << this << "]: executing ASTNodeSubroutine" << endl;
 #endif
 
+    const size_t num_args = get_children().size();
+    vector< uint64_t > args( num_args );
+
+    for( size_t i = 0; i < num_args; i++ ) args[i] = get_children()[i]->execute();
+
+    return call( args.data() );
+}
+
+Bytecode::reg_t ASTNodeSubroutine::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeSubroutine" << endl;
+#endif
+
+    // small subroutines with scalar parameters and without local arrays are
+    // inlined, as long as the body compiles to bytecode completely. Memoized
+    // functions are always called to use the cache.
+    ASTNode::ptr body = m_Body.lock();
+    const bool is_memoized = m_Memo && m_Memo->is_enabled;
+
+    if( body && m_NumVarargs == 0 && !m_LocalArrays->has_locals() && !is_memoized ) {
+        bool has_array_params = false;
+        for( auto& param: m_Params ) has_array_params |= param.is_array;
+
+        if( !has_array_params && code.begin_inline( body.get() ) ) {
+            Bytecode::reg_t ret = compile_inline( code, body.get() );
+            if( code.end_inline() ) return ret;
+        }
+    }
+
+    return compile_call( code );
+}
+
+Bytecode::reg_t ASTNodeSubroutine::compile_inline( Bytecode& code, ASTNode* body )
+{
+    const Bytecode::reg_t base = code.get_top();
+
+    // the arguments are evaluated in the caller's context and become the
+    // registers of the parameters
+    for( size_t i = 0; i < m_Params.size(); i++ ) {
+        Bytecode::reg_t reg = get_children()[i]->compile( code );
+        code.pop_regs( base + i );
+        Bytecode::reg_t arg = code.push_reg();
+        if( reg != arg ) code.emit( Bytecode::OP_MOVE, arg, reg );
+    }
+
+    for( size_t i = 0; i < m_Params.size(); i++ ) code.map_var( m_Params[i].param.var, base + i );
+
+    // a drop of the subroutine must still be detected at the call
+    code.emit_node( Bytecode::OP_CHECK_DROPPED, 0, 0, 0, this );
+
+    // all other locals including the return value start with zero
+    vector< Environment::var* > locals;
+    m_LocalVars->get_locals( locals );
+
+    Bytecode::reg_t retval = base;
+
+    for( Environment::var* var: locals ) {
+        bool is_param = false;
+        for( auto& param: m_Params ) is_param |= param.param.var == var;
+        if( is_param ) continue;
+
+        Bytecode::reg_t reg = code.push_reg();
+        code.emit_value( Bytecode::OP_CONST, reg, 0, 0, 0 );
+        code.map_var( var, reg );
+
+        if( var == m_Retval ) retval = reg;
+    }
+
+    code.begin_inline_body();
+    body->compile( code );
+    code.end_inline_body();
+
+    code.pop_regs( base );
+    Bytecode::reg_t ret = code.push_reg();
+
+    if( m_Retval ) code.emit( Bytecode::OP_MOVE, ret, retval );
+    else code.emit_value( Bytecode::OP_CONST, ret, 0, 0, 0 );
+
+    return ret;
+}
+
+ASTNode::ptr ASTNodeSubroutine::clone_to_const()
+{
+    if( !is_constant() ) return nullptr;
+
+    return make_node<ASTNodeConstant>( get_location(), m_FoldedValue );
+}
+
+bool ASTNodeSubroutine::is_pure()
+{
+    ASTNode::ptr body = m_Body.lock();
+    if( !body || m_NumVarargs > 0 ) return false;
+
+    for( auto& param: m_Params ) {
+        if( param.is_array ) return false;
+    }
+
+    return has_pure_children() && body->is_pure();
+}
+
+bool ASTNodeSubroutine::is_bounded()
+{
+    // the body is not analyzed, this also stops at recursive calls
+    return false;
+}
+
+void ASTNodeSubroutine::check_dropped()
+{
+    if( m_Body.expired() ) throw ASTExceptionDroppedSubroutine( get_location() );
+}
+
+void ASTNodeSubroutine::fold_pure_call()
+{
+    for( const ASTNode::ptr& node: get_children() ) {
+        if( !node->is_constant() ) return;
+    }
+
+    // a call must not hang the parser, not even in a branch that is never executed
+    ASTNode::ptr body = m_Body.lock();
+    if( !is_pure() || !body->is_bounded() ) return;
+
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: running const optimization" << endl;
+#endif
+
+    // runtime errors are reported when the call is executed
+    try {
+        m_FoldedValue = execute();
+    }
+    catch( const ASTRuntimeException& ) {
+        return;
+    }
+
+    set_constant();
+}
+
+uint64_t ASTNodeSubroutine::call( uint64_t* args )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: calling ASTNodeSubroutine" << endl;
+#endif
+
+    if( !m_Memo || !m_Memo->is_enabled ) return call_subroutine( args );
+
+    // a dropped subroutine must fail even for arguments that are in the cache
+    check_dropped();
+
+    vector< uint64_t > key( args, args + m_Params.size() );
+
+    auto iter = m_Memo->results.find( key );
+    if( iter != m_Memo->results.end() ) return iter->second;
+
+    uint64_t ret = call_subroutine( args );
+
+    if( m_Memo->results.size() >= SubroutineManager::MAX_MEMO_SIZE ) m_Memo->results.clear();
+    m_Memo->results[ key ] = ret;
+
+    return ret;
+}
+
+uint64_t ASTNodeSubroutine::call_subroutine( const uint64_t* args )
+{
     int phase = 0;
 
     auto cleanup = [ &phase, this ] () {
@@ -223,31 +562,23 @@ uint64_t ASTNodeSubroutine::execute()
         ASTNode::ptr body = m_Body.lock();
         if( !body ) throw ASTExceptionDroppedSubroutine( get_location() );
 
-        typedef union {
-            uint64_t value;
-            Environment::array* array;
-        } param_t;
-
         const size_t num_params = m_Params.size();
-        vector<param_t> params( num_params );
-
-        for( size_t i = 0; i < num_params; i++ ) {
-            params[i].value = get_children()[i]->execute();
-            if( m_Params[i].is_array ) get_children()[i]->get_array_result( params[i].array );
-        }
 
         m_Env->push_varargs();
         phase = 1;
 
         for( size_t i = 0; i < num_params; i++ ) {
-            if( m_Params[i].is_array ) m_Params[i].param.array->push_ref( params[i].array );
+            if( m_Params[i].is_array ) {
+                Environment::array* array;
+                get_children()[i]->get_array_result( array );
+                m_Params[i].param.array->push_ref( array );
+            }
         }
 
         for( size_t j = 0; j < m_NumVarargs; j++ ) {
             const size_t i = j + num_params;
 
             Environment::array* array;
-            uint64_t value = get_children()[i]->execute();
             bool is_array = get_children()[i]->get_array_result( array );
 
             if( is_array ) {
@@ -255,7 +586,7 @@ uint64_t ASTNodeSubroutine::execute()
                 refarrays.front().set_ref( array );
                 m_Env->append_vararg( &refarrays.front() );
             }
-            else m_Env->append_vararg( value );
+            else m_Env->append_vararg( args[i] );
         }
 
         m_LocalVars->push();
@@ -263,18 +594,16 @@ uint64_t ASTNodeSubroutine::execute()
         phase = 2;
 
         for( size_t i = 0; i < num_params; i++ ) {
-            if( !m_Params[i].is_array ) m_Params[i].param.var->set( params[i].value );
+            if( !m_Params[i].is_array ) m_Params[i].param.var->set( args[i] );
         }
 
         if( m_Retval ) m_Retval->set(0);
 
-        body->execute();
-    }
-    catch( ASTExceptionExit& ) {
-        // nothing to do
-    }
-    catch( ASTExceptionBreak& ) {
-        // nothing to do
+        // subroutine bodies are always blocks, see rule subroutine_block in parser.y
+        static_cast< ASTNodeBlock* >( body.get() )->get_bytecode()->execute();
+
+        // exit and break end the subroutine
+        m_Env->set_completion( Environment::COMPLETION_NORMAL );
     }
     catch( ... ) {
         cleanup();
@@ -335,13 +664,48 @@ uint64_t ASTNodeIf::execute()
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeIf::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeIf" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t condition = get_children()[0]->compile( code );
+    code.pop_regs( top );
+    size_t jump_else = code.emit( Bytecode::OP_JUMP_ZERO, condition );
+
+    get_children()[1]->compile( code );
+    code.pop_regs( top );
+
+    if( get_children().size() > 2 ) {
+        size_t jump_end = code.emit( Bytecode::OP_JUMP );
+        code.set_target( jump_else, code.get_position() );
+
+        get_children()[2]->compile( code );
+        code.pop_regs( top );
+
+        code.set_target( jump_end, code.get_position() );
+    }
+    else code.set_target( jump_else, code.get_position() );
+
+    return code.push_reg();
+}
+
+bool ASTNodeIf::is_pure()
+{
+    return has_pure_children();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeWhile implementation
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodeWhile::ASTNodeWhile( const yylloc_t& yylloc, ASTNode::ptr condition, ASTNode::ptr block )
- : ASTNode( yylloc )
+ASTNodeWhile::ASTNodeWhile( const yylloc_t& yylloc, Environment* env, ASTNode::ptr condition, ASTNode::ptr block )
+ : ASTNode( yylloc ),
+   m_Env( env )
 {
 #ifdef ASTDEBUG
 	cerr << "AST[" << this << "]: creating ASTNodeWhile condition=[" << condition << "] block=[" << block << "]" << endl;
@@ -361,10 +725,11 @@ uint64_t ASTNodeWhile::execute()
 	ASTNode::ptr block = get_children()[1];
 
 	while( condition->execute() ) {
-	    try {
-	        block->execute();
-	    }
-	    catch( ASTExceptionBreak& ) {
+	    block->execute();
+
+	    // break ends this loop, exit is passed on to the enclosing subroutine or script
+	    if( m_Env->get_completion() != Environment::COMPLETION_NORMAL ) {
+	        if( m_Env->get_completion() == Environment::COMPLETION_BREAK ) m_Env->set_completion( Environment::COMPLETION_NORMAL );
 	        break;
 	    }
 	}
@@ -372,13 +737,51 @@ uint64_t ASTNodeWhile::execute()
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeWhile::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeWhile" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    const size_t loop = code.get_position();
+    Bytecode::reg_t condition = get_children()[0]->compile( code );
+    code.pop_regs( top );
+    size_t jump_end = code.emit( Bytecode::OP_JUMP_ZERO, condition );
+
+    code.begin_loop();
+
+    get_children()[1]->compile( code );
+    code.pop_regs( top );
+
+    size_t jump_loop = code.emit( Bytecode::OP_JUMP );
+    code.set_target( jump_loop, loop );
+    code.set_target( jump_end, code.get_position() );
+
+    code.end_loop();
+
+    return code.push_reg();
+}
+
+bool ASTNodeWhile::is_pure()
+{
+    return has_pure_children();
+}
+
+bool ASTNodeWhile::is_bounded()
+{
+    return false;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeFor
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodeFor::ASTNodeFor( const yylloc_t& yylloc, ASTNodeAssign::ptr var, ASTNode::ptr to )
- : ASTNode( yylloc )
+ASTNodeFor::ASTNodeFor( const yylloc_t& yylloc, Environment* env, ASTNodeAssign::ptr var, ASTNode::ptr to )
+ : ASTNode( yylloc ),
+   m_Env( env )
 {
 #ifdef ASTDEBUG
     cerr << "AST[" << this << "]: creating ASTNodeFor var=[" << var << "] to=[" << to << "]" << endl;
@@ -390,8 +793,9 @@ ASTNodeFor::ASTNodeFor( const yylloc_t& yylloc, ASTNodeAssign::ptr var, ASTNode:
     add_child( to );
 }
 
-ASTNodeFor::ASTNodeFor( const yylloc_t& yylloc, ASTNodeAssign::ptr var, ASTNode::ptr to, ASTNode::ptr step )
- : ASTNode( yylloc )
+ASTNodeFor::ASTNodeFor( const yylloc_t& yylloc, Environment* env, ASTNodeAssign::ptr var, ASTNode::ptr to, ASTNode::ptr step )
+ : ASTNode( yylloc ),
+   m_Env( env )
 {
 #ifdef ASTDEBUG
     cerr << "AST[" << this << "]: creating ASTNodeFor var=[" << var << "] to=[" << to << "] step=[" << step << "]" << endl;
@@ -415,10 +819,10 @@ uint64_t ASTNodeFor::execute()
 
     ASTNode::ptr block = get_children()[child];
     for( int64_t i = m_Var->get(); step > 0 && i <= to || step < 0 && i >= to; m_Var->set( i += step ) ) {
-        try {
-            block->execute();
-        }
-        catch( ASTExceptionBreak& ) {
+        block->execute();
+
+        if( m_Env->get_completion() != Environment::COMPLETION_NORMAL ) {
+            if( m_Env->get_completion() == Environment::COMPLETION_BREAK ) m_Env->set_completion( Environment::COMPLETION_NORMAL );
             break;
         }
     }
@@ -426,141 +830,725 @@ uint64_t ASTNodeFor::execute()
     return 0;
 }
 
+Bytecode::reg_t ASTNodeFor::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeFor" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+    int child = 0;
+
+    get_children()[child++]->compile( code ); // assignment of loop variable
+    code.pop_regs( top );
+
+    // to, step and the loop counter stay reserved while the loop body runs
+    Bytecode::reg_t to = get_children()[child++]->compile( code );
+
+    Bytecode::reg_t step;
+    if( get_children().size() > 3 ) step = get_children()[child++]->compile( code );
+    else {
+        step = code.push_reg();
+        code.emit_value( Bytecode::OP_CONST, step, 0, 0, 1 );
+    }
+
+    Bytecode::reg_t index = code.push_reg();
+    code.emit_var( Bytecode::OP_LOAD, index, m_Var );
+
+    const Bytecode::reg_t body_top = code.get_top();
+
+    const size_t loop = code.get_position();
+    size_t jump_end = code.emit( Bytecode::OP_JUMP_FOR_END, index, to, step );
+
+    code.begin_loop();
+
+    get_children()[child]->compile( code );
+    code.pop_regs( body_top );
+
+    code.emit( Bytecode::OP_ADD, index, index, step );
+    code.emit_var( Bytecode::OP_STORE, index, m_Var );
+    size_t jump_loop = code.emit( Bytecode::OP_JUMP );
+    code.set_target( jump_loop, loop );
+    code.set_target( jump_end, code.get_position() );
+
+    code.end_loop();
+
+    code.pop_regs( top );
+    return code.push_reg();
+}
+
+bool ASTNodeFor::is_pure()
+{
+    return has_pure_children();
+}
+
+bool ASTNodeFor::is_bounded()
+{
+    return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodeEvery implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNodeEvery::ASTNodeEvery( const yylloc_t& yylloc, Environment* env, ASTNode::ptr period, int policy )
+ : ASTNode( yylloc ),
+   m_Env( env ),
+   m_Policy( policy )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: creating ASTNodeEvery period=[" << period << "] policy=" << policy << endl;
+#endif
+
+    add_child( period );
+}
+
+ASTNodeEvery::ASTNodeEvery( const yylloc_t& yylloc, Environment* env, ASTNode::ptr period, int policy, std::string stats )
+ : ASTNodeEvery( yylloc, env, period, policy )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: ASTNodeEvery stats=" << stats << endl;
+#endif
+
+    m_Stats = env->alloc_array( stats );
+    if( !m_Stats ) throw ASTExceptionNamingConflict( get_location(), stats );
+}
+
+uint64_t ASTNodeEvery::execute()
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: executing ASTNodeEvery" << endl;
+#endif
+
+    schedule_t schedule;
+    start( schedule, get_children()[0]->execute() );
+
+    ASTNode::ptr block = get_children().size() > 1 ? get_children()[1] : nullptr;
+
+    for(;;) {
+        if( block ) block->execute();
+
+        if( m_Env->get_completion() != Environment::COMPLETION_NORMAL ) {
+            if( m_Env->get_completion() == Environment::COMPLETION_BREAK ) m_Env->set_completion( Environment::COMPLETION_NORMAL );
+            break;
+        }
+
+        wait( schedule );
+    }
+
+    return 0;
+}
+
+Bytecode::reg_t ASTNodeEvery::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeEvery" << endl;
+#endif
+
+    // the scheduling is done by call(), the loop body runs as bytecode. The mode
+    // register is followed by the schedule, which stays reserved while the loop runs
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t mode = code.push_reg();
+    for( size_t i = 0; i < NUM_SCHEDULE_REGS; i++ ) code.push_reg();
+
+    const Bytecode::reg_t body_top = code.get_top();
+
+    code.emit_value( Bytecode::OP_CONST, mode, 0, 0, CALL_START );
+    Bytecode::reg_t period = get_children()[0]->compile( code );
+    if( period != mode + 1 ) code.emit( Bytecode::OP_MOVE, mode + 1, period );
+    code.pop_regs( body_top );
+    code.emit_node( Bytecode::OP_CALL, mode, mode, 0, this );
+
+    const size_t loop = code.get_position();
+
+    code.begin_loop();
+
+    if( get_children().size() > 1 ) {
+        get_children()[1]->compile( code );
+        code.pop_regs( body_top );
+    }
+
+    code.emit_value( Bytecode::OP_CONST, mode, 0, 0, CALL_WAIT );
+    code.emit_node( Bytecode::OP_CALL, mode, mode, 0, this );
+
+    size_t jump_loop = code.emit( Bytecode::OP_JUMP );
+    code.set_target( jump_loop, loop );
+
+    code.end_loop();
+
+    code.pop_regs( top );
+    return code.push_reg();
+}
+
+uint64_t ASTNodeEvery::call( uint64_t* args )
+{
+    // the schedule is copied from and to its registers, see compile()
+    schedule_t schedule;
+    memcpy( &schedule, args + 1, sizeof( schedule ) );
+
+    if( args[0] == CALL_START ) start( schedule, args[1] );
+    else wait( schedule );
+
+    memcpy( args + 1, &schedule, sizeof( schedule ) );
+
+    return 0;
+}
+
+bool ASTNodeEvery::is_bounded()
+{
+    return false;
+}
+
+void ASTNodeEvery::start( schedule_t& schedule, uint64_t period )
+{
+    // the period is given in microseconds like the sleep command
+    schedule.period = std::max< uint64_t >( period, 1 ) * 1000;
+    schedule.deadline = get_monotonic_time();
+
+    schedule.num_runs = 1;
+    schedule.num_overruns = 0;
+    schedule.num_skipped = 0;
+    schedule.min_lateness = 0;
+    schedule.max_lateness = 0;
+    schedule.sum_lateness = 0;
+
+    update_stats( schedule );
+}
+
+void ASTNodeEvery::wait( schedule_t& schedule )
+{
+    uint64_t now = get_monotonic_time();
+    schedule.deadline += schedule.period;
+
+    // the previous run ended after this deadline
+    if( now > schedule.deadline ) {
+        schedule.num_overruns++;
+
+        if( m_Policy == POLICY_SKIP ) {
+            uint64_t missed = ( now - schedule.deadline ) / schedule.period + 1;
+            schedule.deadline += missed * schedule.period;
+            schedule.num_skipped += missed;
+        }
+    }
+
+    if( schedule.deadline > now ) {
+        struct timespec ts;
+        ts.tv_sec = schedule.deadline / 1000000000;
+        ts.tv_nsec = schedule.deadline % 1000000000;
+
+        // the output of a run is visible when it ends, not only after the next one
+        m_Env->get_printbuffer().flush();
+
+        // a request to terminate that arrived after the last statement of the
+        // block would not interrupt the sleep
+        if( m_Env->is_terminated() ) throw ASTExceptionTerminate();
+
+        for(;;) {
+            int ret = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr );
+            if( ret == 0 ) break;
+            if( ret != EINTR ) break;
+            if( m_Env->is_terminated() ) throw ASTExceptionTerminate();
+        }
+
+        now = get_monotonic_time();
+    }
+
+    // lateness of the start of this run, the first run defines the epoch
+    uint64_t lateness = now > schedule.deadline ? now - schedule.deadline : 0;
+
+    if( schedule.num_runs == 1 || lateness < schedule.min_lateness ) schedule.min_lateness = lateness;
+    if( lateness > schedule.max_lateness ) schedule.max_lateness = lateness;
+    schedule.sum_lateness += lateness;
+    schedule.num_runs++;
+
+    update_stats( schedule );
+}
+
+void ASTNodeEvery::update_stats( const schedule_t& schedule )
+{
+    if( !m_Stats ) return;
+
+    if( m_Stats->get_size() != NUM_STATS ) m_Stats->resize( NUM_STATS );
+
+    const uint64_t num_waits = schedule.num_runs - 1;
+
+    m_Stats->set( STAT_RUNS, schedule.num_runs );
+    m_Stats->set( STAT_OVERRUNS, schedule.num_overruns );
+    m_Stats->set( STAT_SKIPPED, schedule.num_skipped );
+    m_Stats->set( STAT_MIN_LATENESS, ( schedule.min_lateness + 500 ) / 1000 );
+    m_Stats->set( STAT_AVG_LATENESS, num_waits ? ( schedule.sum_lateness / num_waits + 500 ) / 1000 : 0 );
+    m_Stats->set( STAT_MAX_LATENESS, ( schedule.max_lateness + 500 ) / 1000 );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodeGuard implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNodeGuard::ASTNodeGuard( const yylloc_t& yylloc, ASTNode::ptr block )
+ : ASTNode( yylloc )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: creating ASTNodeGuard block=[" << block << "]" << endl;
+#endif
+
+    add_child( block );
+}
+
+uint64_t ASTNodeGuard::execute()
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: executing ASTNodeGuard" << endl;
+#endif
+
+    // the interpreted peek and poke nodes arm their own recovery within the
+    // guard, it catches the faults of everything else called from the block
+    uint64_t ret = 0;
+
+    if( !MMap::guard( [&] { ret = get_children()[0]->execute(); } ) ) {
+        throw ASTExceptionBusError( get_location(), MMap::get_fault_address(), MMap::get_fault_size() );
+    }
+
+    return ret;
+}
+
+Bytecode::reg_t ASTNodeGuard::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeGuard" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    code.emit_node( Bytecode::OP_GUARD, 0, 0, 0, this );
+
+    code.begin_guard();
+    get_children()[0]->compile( code );
+    code.pop_regs( top );
+    code.end_guard();
+
+    code.emit( Bytecode::OP_GUARD_END );
+
+    return code.push_reg();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePeek implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNodePeek::ASTNodePeek( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, int size_restriction )
+ : ASTNode( yylloc ),
+   m_Env( env ),
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: creating ASTNodePeek address=[" << address << "] restriction=";
+	switch( m_SizeRestriction ) {
+	case T_8BIT: cerr << "8" << endl; break;
+	case T_16BIT: cerr << "16" << endl; break;
+	case T_32BIT: cerr << "32" << endl; break;
+	case T_64BIT: cerr << "64" << endl; break;
+	default: cerr << "ERR" << endl; break;
+	}
+#endif
+
+	add_child( address );
+
+	resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
+}
+
+uint64_t ASTNodePeek::execute()
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: executing ASTNodePeek" << endl;
+#endif
+
+	void* address = (void*)get_children()[0]->execute();
+
+	switch( m_SizeRestriction ) {
+	case T_8BIT: return peek<uint8_t>( address );
+	case T_16BIT: return peek<uint16_t>( address );
+	case T_32BIT: return peek<uint32_t>( address );
+	case T_64BIT: return peek<uint64_t>( address );
+	};
+
+	return 0;
+}
+
+Bytecode::reg_t ASTNodePeek::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodePeek" << endl;
+#endif
+
+    Bytecode::opcode_t opcode;
+
+	switch( m_SizeRestriction ) {
+	case T_8BIT: opcode = Bytecode::OP_PEEK8; break;
+	case T_16BIT: opcode = Bytecode::OP_PEEK16; break;
+	case T_32BIT: opcode = Bytecode::OP_PEEK32; break;
+	case T_64BIT: opcode = Bytecode::OP_PEEK64; break;
+	default: return ASTNode::compile( code );
+	};
+
+    // the unchecked opcodes follow the checked ones in the same order
+    if( code.is_guarded() ) opcode = (Bytecode::opcode_t)(opcode + Bytecode::OP_PEEK8_UNCHECKED - Bytecode::OP_PEEK8);
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t address = get_children()[0]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_node( opcode, ret, address, 0, this );
+    return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePoke implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNodePoke::ASTNodePoke( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr value, int size_restriction )
+ : ASTNode( yylloc ),
+   m_Env( env ),
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: creating ASTNodePoke address=[" << address << "] value=[" << value << "] restriction=";
+	switch( m_SizeRestriction ) {
+	case T_8BIT: cerr << "8" << endl; break;
+	case T_16BIT: cerr << "16" << endl; break;
+	case T_32BIT: cerr << "32" << endl; break;
+	case T_64BIT: cerr << "64" << endl; break;
+	default: cerr << "ERR" << endl; break;
+	}
+#endif
+
+	add_child( address );
+	add_child( value );
+
+	resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
+}
+
+ASTNodePoke::ASTNodePoke( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr value, ASTNode::ptr mask, int size_restriction )
+ : ASTNode( yylloc ),
+   m_Env( env ),
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: creating ASTNodePoke address=[" << address << "] value=[" << value
+		 << "] mask=[" << mask << "] restriction=";
+	switch( m_SizeRestriction ) {
+	case T_8BIT: cerr << "8" << endl; break;
+	case T_16BIT: cerr << "16" << endl; break;
+	case T_32BIT: cerr << "32" << endl; break;
+	case T_64BIT: cerr << "64" << endl; break;
+	default: cerr << "ERR" << endl; break;
+	}
+#endif
+
+	add_child( address );
+	add_child( value );
+	add_child( mask );
+
+	resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
+}
+
+uint64_t ASTNodePoke::execute()
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: executing ASTNodePoke" << endl;
+#endif
+
+	void* address = (void*)get_children()[0]->execute();
+	uint64_t value = get_children()[1]->execute();
+
+	if( get_children().size() == 2 ) {
+        switch( m_SizeRestriction ) {
+        case T_8BIT: poke<uint8_t>( address, value ); break;
+        case T_16BIT: poke<uint16_t>( address, value ); break;
+        case T_32BIT: poke<uint32_t>( address, value ); break;
+        case T_64BIT: poke<uint64_t>( address, value ); break;
+        };
+	}
+	else {
+	    uint64_t mask = get_children()[2]->execute();
+
+        switch( m_SizeRestriction ) {
+        case T_8BIT: poke<uint8_t>( address, value, mask ); break;
+        case T_16BIT: poke<uint16_t>( address, value, mask ); break;
+        case T_32BIT: poke<uint32_t>( address, value, mask ); break;
+        case T_64BIT: poke<uint64_t>( address, value, mask ); break;
+        };
+	}
+
+	return 0;
+}
+
+Bytecode::reg_t ASTNodePoke::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodePoke" << endl;
+#endif
+
+    const bool has_mask = get_children().size() > 2;
+    Bytecode::opcode_t opcode;
+
+    switch( m_SizeRestriction ) {
+    case T_8BIT: opcode = has_mask ? Bytecode::OP_POKE8_MASK : Bytecode::OP_POKE8; break;
+    case T_16BIT: opcode = has_mask ? Bytecode::OP_POKE16_MASK : Bytecode::OP_POKE16; break;
+    case T_32BIT: opcode = has_mask ? Bytecode::OP_POKE32_MASK : Bytecode::OP_POKE32; break;
+    case T_64BIT: opcode = has_mask ? Bytecode::OP_POKE64_MASK : Bytecode::OP_POKE64; break;
+    default: return ASTNode::compile( code );
+    };
+
+    // the unchecked opcodes follow the checked ones in the same order
+    if( code.is_guarded() ) opcode = (Bytecode::opcode_t)(opcode + Bytecode::OP_POKE8_UNCHECKED - Bytecode::OP_POKE8);
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t address = get_children()[0]->compile( code );
+    Bytecode::reg_t value = get_children()[1]->compile( code );
+    Bytecode::reg_t mask = has_mask ? get_children()[2]->compile( code ) : 0;
+    code.pop_regs( top );
+
+    code.emit_node( opcode, address, value, mask, this );
+    return code.push_reg();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePeekBlock implementation
+//////////////////////////////////////////////////////////////////////////////
+
+ASTNodePeekBlock::ASTNodePeekBlock( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr address,
+                                    ASTNode::ptr count, int size_restriction )
+ : ASTNode( yylloc ),
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: creating ASTNodePeekBlock name=" << name << " address=[" << address
+         << "] count=[" << count << "]" << endl;
+#endif
+
+    m_Array = env->alloc_array( name );
+    if( !m_Array ) throw ASTExceptionNamingConflict( get_location(), name );
+
+    add_child( address );
+    add_child( count );
+
+    resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
+}
+
+uint64_t ASTNodePeekBlock::execute()
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: executing ASTNodePeekBlock" << endl;
+#endif
+
+    void* address = (void*)get_children()[0]->execute();
+    uint64_t count = get_children()[1]->execute();
+
+    switch( m_SizeRestriction ) {
+    case T_8BIT: peek_block<uint8_t>( address, count ); break;
+    case T_16BIT: peek_block<uint16_t>( address, count ); break;
+    case T_32BIT: peek_block<uint32_t>( address, count ); break;
+    case T_64BIT: peek_block<uint64_t>( address, count ); break;
+    }
+
+    return 0;
+}
+
+template< typename T >
+void ASTNodePeekBlock::peek_block( void* address, uint64_t count )
+{
+    MMap* mmap = m_Mapping.get_block( get_location(), address, sizeof(T), count );
+
+    if( m_Array->get_size() != count ) m_Array->resize( count );
+
+    // the words are read directly into the packed elements of the array
+    void* buffer = m_Array->get_buffer();
+    bool is_ok;
+
+    switch( m_Array->get_width() ) {
+    case 1: is_ok = mmap->read_block<T>( address, (uint8_t*)buffer, count ); break;
+    case 2: is_ok = mmap->read_block<T>( address, (uint16_t*)buffer, count ); break;
+    case 4: is_ok = mmap->read_block<T>( address, (uint32_t*)buffer, count ); break;
+    default: is_ok = mmap->read_block<T>( address, (uint64_t*)buffer, count ); break;
+    }
+
+    if( !is_ok ) {
+        throw ASTExceptionBusError( get_location(), MMap::get_fault_address(), sizeof(T) );
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
-// class ASTNodePeek implementation
+// class ASTNodePokeBlock implementation
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodePeek::ASTNodePeek( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, int size_restriction )
+ASTNodePokeBlock::ASTNodePokeBlock( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, std::string name,
+                                    ASTNode::ptr count, int size_restriction )
  : ASTNode( yylloc ),
-   m_Env( env ),
-   m_SizeRestriction( size_restriction )
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
 {
 #ifdef ASTDEBUG
-	cerr << "AST[" << this << "]: creating ASTNodePeek address=[" << address << "] restriction=";
-	switch( m_SizeRestriction ) {
-	case T_8BIT: cerr << "8" << endl; break;
-	case T_16BIT: cerr << "16" << endl; break;
-	case T_32BIT: cerr << "32" << endl; break;
-	case T_64BIT: cerr << "64" << endl; break;
-	default: cerr << "ERR" << endl; break;
-	}
+    cerr << "AST[" << this << "]: creating ASTNodePokeBlock address=[" << address << "] name=" << name
+         << " count=[" << count << "]" << endl;
 #endif
 
-	add_child( address );
+    m_Array = env->get_array( name );
+    if( !m_Array ) throw ASTExceptionUndefinedVar( get_location(), name );
+
+    add_child( address );
+    add_child( count );
+
+    resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
 }
 
-uint64_t ASTNodePeek::execute()
+uint64_t ASTNodePokeBlock::execute()
 {
 #ifdef ASTDEBUG
-	cerr << "AST[" << this << "]: executing ASTNodePeek" << endl;
+    cerr << "AST[" << this << "]: executing ASTNodePokeBlock" << endl;
 #endif
 
-	switch( m_SizeRestriction ) {
-	case T_8BIT: return peek<uint8_t>();
-	case T_16BIT: return peek<uint16_t>();
-	case T_32BIT: return peek<uint32_t>();
-	case T_64BIT: return peek<uint64_t>();
-	};
+    void* address = (void*)get_children()[0]->execute();
+    uint64_t count = get_children()[1]->execute();
 
-	return 0;
+    switch( m_SizeRestriction ) {
+    case T_8BIT: poke_block<uint8_t>( address, count ); break;
+    case T_16BIT: poke_block<uint16_t>( address, count ); break;
+    case T_32BIT: poke_block<uint32_t>( address, count ); break;
+    case T_64BIT: poke_block<uint64_t>( address, count ); break;
+    }
+
+    return 0;
 }
 
 template< typename T >
-uint64_t ASTNodePeek::peek()
+void ASTNodePokeBlock::poke_block( void* address, uint64_t count )
 {
-	void* address = (void*)get_children()[0]->execute();
-	MMap* mmap = m_Env->get_mapping( address, sizeof(T) );
+    if( count > m_Array->get_size() ) throw ASTExceptionOutOfBounds( get_location(), count - 1, m_Array->get_size() );
 
-    if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+    MMap* mmap = m_Mapping.get_block( get_location(), address, sizeof(T), count );
 
-    uint64_t ret = mmap->peek<T>( address );
-    if( mmap->has_failed() ) throw ASTExceptionBusError( get_location(), address, sizeof(T) );
+    const void* buffer = m_Array->get_buffer();
+    bool is_ok;
 
-    return ret;
+    switch( m_Array->get_width() ) {
+    case 1: is_ok = mmap->write_block<T>( address, (const uint8_t*)buffer, count ); break;
+    case 2: is_ok = mmap->write_block<T>( address, (const uint16_t*)buffer, count ); break;
+    case 4: is_ok = mmap->write_block<T>( address, (const uint32_t*)buffer, count ); break;
+    default: is_ok = mmap->write_block<T>( address, (const uint64_t*)buffer, count ); break;
+    }
+
+    if( !is_ok ) {
+        throw ASTExceptionBusError( get_location(), MMap::get_fault_address(), sizeof(T) );
+    }
 }
 
 
 //////////////////////////////////////////////////////////////////////////////
-// class ASTNodePoke implementation
+// class ASTNodeMemFind implementation
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodePoke::ASTNodePoke( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr value, int size_restriction )
+ASTNodeMemFind::ASTNodeMemFind( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr count,
+                                ASTNode::ptr value, ASTNode::ptr mask, int size_restriction )
  : ASTNode( yylloc ),
-   m_Env( env ),
-   m_SizeRestriction( size_restriction )
+   m_SizeRestriction( size_restriction ),
+   m_Mapping( env )
 {
 #ifdef ASTDEBUG
-	cerr << "AST[" << this << "]: creating ASTNodePoke address=[" << address << "] value=[" << value << "] restriction=";
-	switch( m_SizeRestriction ) {
-	case T_8BIT: cerr << "8" << endl; break;
-	case T_16BIT: cerr << "16" << endl; break;
-	case T_32BIT: cerr << "32" << endl; break;
-	case T_64BIT: cerr << "64" << endl; break;
-	default: cerr << "ERR" << endl; break;
-	}
+    cerr << "AST[" << this << "]: creating ASTNodeMemFind address=[" << address << "] count=[" << count
+         << "] value=[" << value << "] mask=[" << mask << "]" << endl;
 #endif
 
-	add_child( address );
-	add_child( value );
+    if( !mask ) mask = make_node<ASTNodeConstant>( yylloc, ~(uint64_t)0 );
+
+    add_child( address );
+    add_child( count );
+    add_child( value );
+    add_child( mask );
+
+    resolve_mapping( m_Mapping, get_children()[0], m_SizeRestriction );
 }
 
-ASTNodePoke::ASTNodePoke( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr value, ASTNode::ptr mask, int size_restriction )
- : ASTNode( yylloc ),
-   m_Env( env ),
-   m_SizeRestriction( size_restriction )
+ASTNodeMemFind::ASTNodeMemFind( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr address,
+                                ASTNode::ptr count, ASTNode::ptr value, ASTNode::ptr mask, int size_restriction )
+ : ASTNodeMemFind( yylloc, env, address, count, value, mask, size_restriction )
 {
 #ifdef ASTDEBUG
-	cerr << "AST[" << this << "]: creating ASTNodePoke address=[" << address << "] value=[" << value
-		 << "] mask=[" << mask << "] restriction=";
-	switch( m_SizeRestriction ) {
-	case T_8BIT: cerr << "8" << endl; break;
-	case T_16BIT: cerr << "16" << endl; break;
-	case T_32BIT: cerr << "32" << endl; break;
-	case T_64BIT: cerr << "64" << endl; break;
-	default: cerr << "ERR" << endl; break;
-	}
+    cerr << "AST[" << this << "]: ASTNodeMemFind name=" << name << endl;
 #endif
 
-	add_child( address );
-	add_child( value );
-	add_child( mask );
+    m_Array = env->alloc_array( name );
+    if( !m_Array ) throw ASTExceptionNamingConflict( get_location(), name );
 }
 
-uint64_t ASTNodePoke::execute()
+uint64_t ASTNodeMemFind::execute()
 {
 #ifdef ASTDEBUG
-	cerr << "AST[" << this << "]: executing ASTNodePoke" << endl;
+    cerr << "AST[" << this << "]: executing ASTNodeMemFind" << endl;
 #endif
 
-	switch( m_SizeRestriction ) {
-	case T_8BIT: poke<uint8_t>(); break;
-	case T_16BIT: poke<uint16_t>(); break;
-	case T_32BIT: poke<uint32_t>(); break;
-	case T_64BIT: poke<uint64_t>(); break;
-	};
+    void* address = (void*)get_children()[0]->execute();
+    uint64_t count = get_children()[1]->execute();
+    uint64_t value = get_children()[2]->execute();
+    uint64_t mask = get_children()[3]->execute();
 
-	return 0;
+    switch( m_SizeRestriction ) {
+    case T_8BIT: return mem_find<uint8_t>( address, count, value, mask );
+    case T_16BIT: return mem_find<uint16_t>( address, count, value, mask );
+    case T_32BIT: return mem_find<uint32_t>( address, count, value, mask );
+    default: return mem_find<uint64_t>( address, count, value, mask );
+    }
 }
 
 template< typename T >
-void ASTNodePoke::poke()
+uint64_t ASTNodeMemFind::mem_find( void* address, uint64_t count, uint64_t value, uint64_t mask )
 {
-	void* address = (void*)get_children()[0]->execute();
-	T value = get_children()[1]->execute();
+    MMap* mmap = m_Mapping.get_block( get_location(), address, sizeof(T), count );
 
-	MMap* mmap = m_Env->get_mapping( address, sizeof(T) );
+    uint64_t first = ~(uint64_t)0;
+    std::vector< uint64_t > matches;
 
-	if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+    // only the bits set in mask are compared, a masked value that has bits above
+    // the element size set never matches
+    bool is_ok = true;
+    if( ( value & mask ) == (T)( value & mask ) ) {
+        is_ok = mmap->find_block<T>( address, count, (T)( value & mask ), (T)mask, [&] ( size_t index ) {
+            uint64_t match = (uint64_t)address + index * sizeof(T);
 
-	if( get_children().size() == 2 ) mmap->poke<T>( address, value );
-	else {
-		T mask = get_children()[2]->execute();
-		mmap->clear<T>( address, mask );
-		mmap->set<T>( address, value & mask);
-	}
+            if( !m_Array ) {
+                first = match;
+                return false;
+            }
+
+            matches.push_back( match );
+            return true;
+        });
+    }
+
+    if( !is_ok ) {
+        throw ASTExceptionBusError( get_location(), MMap::get_fault_address(), sizeof(T) );
+    }
+
+    if( m_Array ) {
+        if( m_Array->get_size() != matches.size() ) m_Array->resize( matches.size() );
+        for( size_t i = 0; i < matches.size(); i++ ) m_Array->set( i, matches[i] );
+        return 0;
+    }
 
-    if( mmap->has_failed() ) throw ASTExceptionBusError( get_location(), address, sizeof(T) );
+    return first;
 }
 
 
@@ -603,20 +1591,22 @@ uint64_t ASTNodePrint::execute()
 	cerr << "AST[" << this << "]: executing ASTNodePrint" << endl;
 #endif
 
-	for( arg_t arg: m_Args ) {
+	PrintBuffer& out = m_Env->get_printbuffer();
+
+	for( const arg_t& arg: m_Args ) {
 		if( arg.node ) {
 	        Environment::array* array;
 	        uint64_t value = arg.node->execute();
-	        if( (arg.mode & MOD_ARRAYMASK ) != 0 && arg.node->get_array_result( array ) ) print_array( cout, array, arg.mode );
-	        else print_value( cout, value, arg.mode );
+	        if( (arg.mode & MOD_ARRAYMASK ) != 0 && arg.node->get_array_result( array ) ) print_array( out, array, arg.mode );
+	        else print_value( out, value, arg.mode );
 		}
 		else {
-			cout << arg.text;
+			out.write( arg.text );
 		}
 	}
 
-	if( m_PrintEndl ) cout << endl;
-	else cout << flush;
+	if( m_PrintEndl ) out.end_line();
+	else if( out.is_line_buffered() ) out.flush(); // e.g. a prompt before a sleep
 
 	return 0;
 }
@@ -632,7 +1622,7 @@ int ASTNodePrint::size_to_mod( int size )
 	}
 }
 
-void ASTNodePrint::print_value( std::ostream& out, uint64_t value, int modifier )
+void ASTNodePrint::print_value( PrintBuffer& out, uint64_t value, int modifier )
 {
 	int size = 0;
 	int64_t nvalue;
@@ -663,60 +1653,54 @@ void ASTNodePrint::print_value( std::ostream& out, uint64_t value, int modifier
 	}
 
 	switch( modifier & MOD_TYPEMASK ) {
-	case MOD_HEX: {
-		const ios_base::fmtflags oldflags = out.flags( ios::hex | ios::right | ios::fixed );
-		out << "0x" << setw( 2 * size ) << setfill('0') << value;
-		out.flags( oldflags );
+	case MOD_HEX:
+		out.put_hex( value, 2 * size );
 		break;
-	}
 
 	case MOD_DEC:
-	case MOD_NEG: {
-		const ios_base::fmtflags oldflags = out.flags( ios::dec | ios::right | ios::fixed );
-		if( (modifier & MOD_TYPEMASK) == MOD_DEC ) out << value;
-		else out << nvalue;
-		out.flags( oldflags );
+		out.put_dec( value );
 		break;
-	}
 
-	case MOD_BIN: {
-		for( int i = size * 8 - 1; i >= 0; i-- ) {
-			out << ((value & ((uint64_t)1 << i)) ? '1' : '0');
-			if( i > 0 && i % 4 == 0 ) out << ' ';
-		}
+	case MOD_NEG:
+		out.put_signed( nvalue );
+		break;
+
+	case MOD_BIN:
+		out.put_bin( value, size * 8 );
 		break;
-	}
 
 	case MOD_FLOAT: {
 	    assert( (modifier & MOD_SIZEMASK) == MOD_64BIT );
 	    double d = *(double*)&value;
-	    out << d;
+	    out.put_float( d );
 	    break;
 	}
 
 	}
 }
 
-void ASTNodePrint::print_array( std::ostream& out, Environment::array* array, int modifier )
+void ASTNodePrint::print_array( PrintBuffer& out, Environment::array* array, int modifier )
 {
     const size_t size = array->get_size();
 
     switch( modifier & MOD_ARRAYMASK ) {
     case MOD_ARRAY: {
         if( size ) {
-            out << '[';
+            out.put( '[' );
             for( size_t i = 0; i < size; i++ ) {
-                out << ' ';
+                out.put( ' ' );
                 print_value( out, array->get(i), modifier );
             }
-            out << " ]";
+            out.write( " ]", 2 );
         }
-        else out << "[]";
+        else out.write( "[]", 2 );
         break;
     }
 
     case MOD_STRING: {
-        out << ASTNodeString::get_string( array );
+        size_t length;
+        const char* str = ASTNodeString::get_chars( array, length );
+        out.write( str, length );
         break;
     }
 
@@ -778,6 +1762,9 @@ uint64_t ASTNodeSleep::execute()
         }
     }
 
+    // output printed before the sleep must not be delayed by it
+    m_Env->get_printbuffer().flush();
+
     for(;;) {
         int ret = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr );
         if( ret == 0 ) break;
@@ -898,6 +1885,41 @@ uint64_t ASTNodeAssign::execute()
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeAssign::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeAssign" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+	switch( m_Type ) {
+	case VAR: {
+	    Bytecode::reg_t value = get_children()[0]->compile( code );
+	    code.emit_var( Bytecode::OP_STORE, value, m_LValue.var );
+	    break;
+	}
+
+	case ARRAY: {
+        Bytecode::reg_t index = get_children()[0]->compile( code );
+        Bytecode::reg_t value = get_children()[1]->compile( code );
+        code.emit_array( Bytecode::OP_ARRAY_SET, index, value, 0, m_LValue.array );
+        break;
+	}
+
+	default:
+	    return ASTNode::compile( code );
+	}
+
+	code.pop_regs( top );
+	return code.push_reg();
+}
+
+bool ASTNodeAssign::is_pure()
+{
+    return m_Type == VAR && m_LValue.var->is_local() && has_pure_children();
+}
+
 Environment::var* ASTNodeAssign::get_var()
 {
     return ( m_Type == VAR ) ? m_LValue.var : nullptr;
@@ -981,55 +2003,76 @@ bool ASTNodeString::get_array_result( Environment::array*& array )
     return true;
 }
 
+// strings are stored as bytes in memory order, each element holds as many
+// characters as it has bytes
 size_t ASTNodeString::get_length( const Environment::array* array )
 {
-    const size_t size = array->get_size();
-	size_t len = 0;
-
-	for( size_t i = 0; i < size; i++ ) {
-		element_t value;
-		value.integer = array->get(i);
+    const size_t size = array->get_size() * array->get_width();
+    if( size == 0 ) return 0;
 
-		for( size_t j = 0; j < 8; j++ ) {
-			if( value.string[j] ) len++;
-			else return len;
-		}
-	}
+    const char* str = (const char*)array->get_buffer();
+    const char* end = (const char*)memchr( str, 0, size );
 
-	return len;
+    return end ? end - str : size;
 }
 
 std::string ASTNodeString::get_string( const Environment::array* array )
 {
-    const size_t size = array->get_size();
-	string str;
-
-	for( size_t i = 0; i < size; i++ ) {
-		element_t value;
-		value.integer = array->get(i);
-		for( size_t j = 0; j < 8; j++ ) {
-			uint8_t c = value.string[j];
-			if( c ) str += c;
-			else return str;
-		}
-	}
+    size_t length;
+    const char* str = get_chars( array, length );
 
-	return str;
+    return string( str, length );
 }
 
-void ASTNodeString::set_string( Environment::array* array, std::string str )
+void ASTNodeString::set_string( Environment::array* array, const std::string& str )
 {
-	const size_t size = (str.length() + 7) / 8;
-	array->resize( size );
+    set_string( array, str.data(), str.length() );
+}
 
-	for( size_t i = 0; i < size; i++ ) {
-		element_t value;
-		for( size_t j = 0; j < 8; j++ ) {
-			size_t pos = 8 * i + j;
-			value.string[j] = (pos < str.length()) ? str[pos] : 0;
-		}
-		array->set( i, value.integer );
-	}
+const char* ASTNodeString::get_chars( const Environment::array* array, size_t& length )
+{
+    length = get_length( array );
+    return length > 0 ? (const char*)array->get_buffer() : "";
+}
+
+void ASTNodeString::set_string( Environment::array* array, const char* str, size_t length )
+{
+    const size_t width = array->get_width();
+    const size_t size = (length + width - 1) / width;
+
+    // a substring of the array is moved to the front, which survives resizing
+    char* buffer = (char*)array->get_buffer();
+    const bool is_inside = buffer && str >= buffer && str < buffer + array->get_size() * width;
+    if( is_inside && str != buffer ) memmove( buffer, str, length );
+
+    array->resize( size );
+
+    if( size > 0 ) {
+        buffer = (char*)array->get_buffer();
+        if( !is_inside ) memcpy( buffer, str, length );
+        memset( buffer + length, 0, size * width - length );
+    }
+}
+
+void ASTNodeString::append_string( Environment::array* array, const char* str, size_t length )
+{
+    const size_t width = array->get_width();
+    const size_t old_length = get_length( array );
+    const size_t size = (old_length + length + width - 1) / width;
+
+    char* buffer = (char*)array->get_buffer();
+    const bool is_inside = buffer && str >= buffer && str < buffer + array->get_size() * width;
+    const size_t offset = is_inside ? str - buffer : 0;
+
+    // the array reserves headroom when growing, so appending is amortized
+    array->resize( size );
+
+    if( size > 0 ) {
+        buffer = (char*)array->get_buffer();
+        if( is_inside ) str = buffer + offset;
+        if( length > 0 ) memmove( buffer + old_length, str, length );
+        memset( buffer + old_length + length, 0, size * width - old_length - length );
+    }
 }
 
 
@@ -1077,7 +2120,7 @@ ASTNodeStatic::ASTNodeStatic( const yylloc_t& yylloc, Environment* env, std::str
     if( is_var ) m_Data.var = env->alloc_static_var( name );
     else m_Data.array = env->alloc_static_array( name );
 
-    if( expression->is_constant() ) add_child( make_shared<ASTNodeConstant>( yylloc, compiletime_execute( expression ) ) );
+    if( expression->is_constant() ) add_child( make_node<ASTNodeConstant>( yylloc, compiletime_execute( expression ) ) );
     else add_child( expression );
 
     if( is_var && !m_Data.var || !is_var && !m_Data.array ) throw ASTExceptionNamingConflict( get_location(), name );
@@ -1223,12 +2266,18 @@ uint64_t ASTNodeDef::execute()
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeDef::compile( Bytecode& code )
+{
+    // nothing to do
+    return code.push_reg();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeDim implementation
 //////////////////////////////////////////////////////////////////////////////
 
-ASTNodeDim::ASTNodeDim( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr size )
+ASTNodeDim::ASTNodeDim( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr size, int size_restriction )
  : ASTNode( yylloc )
 {
 #ifdef ASTDEBUG
@@ -1238,6 +2287,13 @@ ASTNodeDim::ASTNodeDim( const yylloc_t& yylloc, Environment* env, std::string na
     m_Array = env->alloc_array( name );
     if( !m_Array ) throw ASTExceptionNamingConflict( get_location(), name );
 
+    switch( size_restriction ) {
+    case T_8BIT: m_Width = 1; break;
+    case T_16BIT: m_Width = 2; break;
+    case T_32BIT: m_Width = 4; break;
+    case T_64BIT: m_Width = 8; break;
+    }
+
     add_child( size );
 }
 
@@ -1248,6 +2304,7 @@ uint64_t ASTNodeDim::execute()
 #endif
 
     uint64_t size = get_children()[0]->execute();
+    if( m_Width ) m_Array->set_width( m_Width );
     m_Array->resize( size );
 
     return 0;
@@ -1301,13 +2358,20 @@ uint64_t ASTNodeMap::execute()
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeMap::compile( Bytecode& code )
+{
+    // nothing to do
+    return code.push_reg();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeImport implementation
 //////////////////////////////////////////////////////////////////////////////
 
 ASTNodeImport::ASTNodeImport( const yylloc_t& yylloc, Environment* env, std::string file, bool run_once )
- : ASTNode( yylloc )
+ : ASTNode( yylloc ),
+   m_Env( env )
 {
 #ifdef ASTDEBUG
 	cerr << "AST[" << this << "]: creating ASTNodeImport file=" << file << endl;
@@ -1323,19 +2387,33 @@ uint64_t ASTNodeImport::execute()
 	cerr << "AST[" << this << "]: executing ASTNodeImport" << endl;
 #endif
 
-	try {
-		if( get_children().size() > 0 ) get_children()[0]->execute();
-	}
-    catch( ASTExceptionExit& ) {
-        // nothing to do
-    }
-	catch( ASTExceptionBreak& ) {
-		// nothing to do
-	}
+	if( get_children().size() > 0 ) get_children()[0]->execute();
+
+	// exit and break in the imported script return to the importing script
+	m_Env->set_completion( Environment::COMPLETION_NORMAL );
 
 	return 0;
 }
 
+Bytecode::reg_t ASTNodeImport::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeImport" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    // exit and break in the imported script return to the importing script
+    if( get_children().size() > 0 ) {
+        code.begin_unit();
+        get_children()[0]->compile( code );
+        code.end_unit();
+    }
+
+    code.pop_regs( top );
+    return code.push_reg();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeUnaryOperator implementation
@@ -1371,6 +2449,36 @@ uint64_t ASTNodeUnaryOperator::execute()
 	}
 }
 
+Bytecode::reg_t ASTNodeUnaryOperator::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeUnaryOperator" << endl;
+#endif
+
+    Bytecode::opcode_t opcode;
+
+    switch( m_Operator ) {
+    case T_MINUS: opcode = Bytecode::OP_NEG; break;
+    case T_BIT_NOT: opcode = Bytecode::OP_BIT_NOT; break;
+    case T_LOG_NOT: opcode = Bytecode::OP_LOG_NOT; break;
+    default: return ASTNode::compile( code );
+    }
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t r = get_children()[0]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit( opcode, ret, r );
+    return ret;
+}
+
+bool ASTNodeUnaryOperator::is_pure()
+{
+    return has_pure_children();
+}
+
 ASTNode::ptr ASTNodeUnaryOperator::clone_to_const()
 {
     if( !is_constant() ) return nullptr;
@@ -1379,7 +2487,7 @@ ASTNode::ptr ASTNodeUnaryOperator::clone_to_const()
     cerr << "AST[" << this << "]: running const optimization" << endl;
 #endif
 
-    return make_shared<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
+    return make_node<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
 }
 
 
@@ -1442,6 +2550,59 @@ uint64_t ASTNodeBinaryOperator::execute()
 	}
 }
 
+Bytecode::reg_t ASTNodeBinaryOperator::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeBinaryOperator" << endl;
+#endif
+
+    Bytecode::opcode_t opcode;
+
+	switch( m_Operator ) {
+	case T_PLUS: opcode = Bytecode::OP_ADD; break;
+	case T_MINUS: opcode = Bytecode::OP_SUB; break;
+	case T_MUL: opcode = Bytecode::OP_MUL; break;
+	case T_DIV: opcode = Bytecode::OP_DIV; break;
+	case T_MOD: opcode = Bytecode::OP_MOD; break;
+	case T_SDIV: opcode = Bytecode::OP_SDIV; break;
+	case T_SMOD: opcode = Bytecode::OP_SMOD; break;
+	case T_LSHIFT: opcode = Bytecode::OP_LSHIFT; break;
+	case T_RSHIFT: opcode = Bytecode::OP_RSHIFT; break;
+	case T_LT: opcode = Bytecode::OP_LT; break;
+	case T_GT: opcode = Bytecode::OP_GT; break;
+	case T_LE: opcode = Bytecode::OP_LE; break;
+	case T_GE: opcode = Bytecode::OP_GE; break;
+	case T_EQ: opcode = Bytecode::OP_EQ; break;
+	case T_NE: opcode = Bytecode::OP_NE; break;
+	case T_SLT: opcode = Bytecode::OP_SLT; break;
+	case T_SGT: opcode = Bytecode::OP_SGT; break;
+	case T_SLE: opcode = Bytecode::OP_SLE; break;
+	case T_SGE: opcode = Bytecode::OP_SGE; break;
+	case T_BIT_AND: opcode = Bytecode::OP_BIT_AND; break;
+	case T_BIT_XOR: opcode = Bytecode::OP_BIT_XOR; break;
+	case T_BIT_OR: opcode = Bytecode::OP_BIT_OR; break;
+	case T_LOG_AND: opcode = Bytecode::OP_LOG_AND; break;
+	case T_LOG_XOR: opcode = Bytecode::OP_LOG_XOR; break;
+	case T_LOG_OR: opcode = Bytecode::OP_LOG_OR; break;
+	default: return ASTNode::compile( code );
+	}
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t r0 = get_children()[0]->compile( code );
+    Bytecode::reg_t r1 = get_children()[1]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_node( opcode, ret, r0, r1, this );
+    return ret;
+}
+
+bool ASTNodeBinaryOperator::is_pure()
+{
+    return has_pure_children();
+}
+
 ASTNode::ptr ASTNodeBinaryOperator::clone_to_const()
 {
     if( !is_constant() ) return nullptr;
@@ -1450,7 +2611,7 @@ ASTNode::ptr ASTNodeBinaryOperator::clone_to_const()
     cerr << "AST[" << this << "]: running const optimization" << endl;
 #endif
 
-    return make_shared<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
+    return make_node<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
 }
 
 
@@ -1495,6 +2656,36 @@ uint64_t ASTNodeRestriction::execute()
 	return result;
 }
 
+Bytecode::reg_t ASTNodeRestriction::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeRestriction" << endl;
+#endif
+
+    uint64_t mask;
+
+	switch( m_SizeRestriction ) {
+	case T_8BIT: mask = 0xff; break;
+	case T_16BIT: mask = 0xffff; break;
+	case T_32BIT: mask = 0xffffffff; break;
+	default: mask = 0xffffffffffffffff; break;
+	}
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t r = get_children()[0]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_value( Bytecode::OP_AND_CONST, ret, r, 0, mask );
+    return ret;
+}
+
+bool ASTNodeRestriction::is_pure()
+{
+    return has_pure_children();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeVar implementation
@@ -1524,6 +2715,23 @@ uint64_t ASTNodeVar::execute()
 	else return 0;
 }
 
+Bytecode::reg_t ASTNodeVar::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeVar" << endl;
+#endif
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_var( Bytecode::OP_LOAD, ret, const_cast< Environment::var* >( m_Var ) );
+    return ret;
+}
+
+bool ASTNodeVar::is_pure()
+{
+    // globals and statics may be changed between calls
+    return m_Var->is_local() || m_Var->is_def();
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeArg implementation
@@ -1645,10 +2853,37 @@ uint64_t ASTNodeRange::execute()
 
     if( !m_Var ) return 0;
 
-    uint64_t range = m_Var->get_range();
-    if( get_children().size() == 0 ) return range;
+    if( get_children().size() == 0 ) return m_Var->get_range();
 
-    uint64_t index = get_children()[0]->execute();
+    return get_address( get_children()[0]->execute() );
+}
+
+Bytecode::reg_t ASTNodeRange::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeRange" << endl;
+#endif
+
+    if( !m_Var || get_children().size() == 0 ) return ASTNode::compile( code );
+
+    const Bytecode::reg_t top = code.get_top();
+
+    Bytecode::reg_t index = get_children()[0]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_node( Bytecode::OP_RANGE, ret, index, 0, this );
+    return ret;
+}
+
+bool ASTNodeRange::is_pure()
+{
+    return has_pure_children();
+}
+
+uint64_t ASTNodeRange::get_address( uint64_t index )
+{
+    uint64_t range = m_Var->get_range();
     if( index >= range ) throw ASTExceptionOutOfBounds( get_location(), index, range );
 
     uint64_t value = m_Var->get();
@@ -1704,6 +2939,28 @@ bool ASTNodeArray::get_array_result( Environment::array*& array )
     return true;
 }
 
+Bytecode::reg_t ASTNodeArray::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+    cerr << "AST[" << this << "]: compiling ASTNodeArray" << endl;
+#endif
+
+    const Bytecode::reg_t top = code.get_top();
+
+    if( get_children().size() == 0 ) {
+        Bytecode::reg_t ret = code.push_reg();
+        code.emit_array( Bytecode::OP_ARRAY_SIZE, ret, 0, 0, m_Array );
+        return ret;
+    }
+
+    Bytecode::reg_t index = get_children()[0]->compile( code );
+    code.pop_regs( top );
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_array( Bytecode::OP_ARRAY_GET, ret, index, 0, m_Array );
+    return ret;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeConstant implementation
@@ -1740,4 +2997,20 @@ uint64_t ASTNodeConstant::execute()
 #endif
 
 	return m_Value;
-};
+}
+
+Bytecode::reg_t ASTNodeConstant::compile( Bytecode& code )
+{
+#ifdef ASTDEBUG
+	cerr << "AST[" << this << "]: compiling ASTNodeConstant" << endl;
+#endif
+
+    Bytecode::reg_t ret = code.push_reg();
+    code.emit_value( Bytecode::OP_CONST, ret, 0, 0, m_Value );
+    return ret;
+}
+
+bool ASTNodeConstant::is_pure()
+{
+    return true;
+}
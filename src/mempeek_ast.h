@@ -29,6 +29,8 @@
 #include "mempeek_parser.h"
 #include "environment.h"
 #include "subroutines.h"
+#include "bytecode.h"
+#include "astarena.h"
 
 #include <ostream>
 #include <string>
@@ -62,19 +64,35 @@ public:
 	virtual uint64_t execute() = 0;
     virtual bool get_array_result( Environment::array*& array );
 
+    virtual Bytecode::reg_t compile( Bytecode& code );
+
+    // called by OP_CALL with the registers of the arguments, a node may also use
+    // them to keep state of the current execution
+    virtual uint64_t call( uint64_t* args );
+
 	bool is_constant();
 	virtual ASTNode::ptr clone_to_const();
 
+    // pure nodes have no side effects and only depend on locals and constants
+    virtual bool is_pure();
+
+    // bounded nodes always terminate, they contain neither loops nor subroutine calls
+    virtual bool is_bounded();
+
 protected:
     static uint64_t compiletime_execute( ASTNode::ptr node );
     static uint64_t compiletime_execute( ASTNode* node );
 
-	typedef std::vector< ASTNode::ptr > nodelist_t;
+    Bytecode::reg_t compile_call( Bytecode& code );
+
+	typedef std::vector< ASTNode::ptr, ASTArena::allocator< ASTNode::ptr > > nodelist_t;
 
 	const nodelist_t& get_children();
 
 	void set_constant();
 
+	bool has_pure_children();
+
 private:
     yylloc_t m_Location;
 
@@ -86,6 +104,9 @@ private:
 	ASTNode& operator=( const ASTNode& ) = delete;
 };
 
+// creates a node in the arena of the current parse, or on the heap outside of parsing
+template< typename T, typename... ARGS > std::shared_ptr< T > make_node( ARGS&&... args );
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeBuiltin
@@ -104,10 +125,17 @@ public:
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+    uint64_t call( uint64_t* args ) override;
+
 	virtual ASTNode::ptr clone_to_const() override;
 
+    bool is_pure() override;
+
 private:
     std::function< uint64_t( const args_t& ) > m_Builtin;
+
+    bool m_IsPure;
 };
 
 
@@ -119,11 +147,16 @@ class ASTNodeBreak : public ASTNode {
 public:
     typedef std::shared_ptr<ASTNodeBreak> ptr;
 
-    ASTNodeBreak( const yylloc_t& yylloc, int token );
+    ASTNodeBreak( const yylloc_t& yylloc, Environment* env, int token );
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
 private:
+    Environment* m_Env;
     int m_Token;
 };
 
@@ -140,8 +173,20 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    Bytecode* get_bytecode();
+
+    bool is_pure() override;
+
 private:
 	Environment* m_Env;
+
+	Bytecode::ptr m_Bytecode;
+
+    // the result of is_pure() is cached, recursive calls are assumed to be pure
+    // while the block is analyzed
+    enum { PURITY_UNKNOWN, PURITY_ANALYZING, PURITY_PURE, PURITY_IMPURE } m_Purity = PURITY_UNKNOWN;
 };
 
 
@@ -158,6 +203,8 @@ public:
     uint64_t execute() override;
     bool get_array_result( Environment::array*& array ) override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
 private:
     Environment::array* m_Array;
 
@@ -176,11 +223,29 @@ public:
     ASTNodeSubroutine( const yylloc_t& yylloc, std::weak_ptr<ASTNode> body,
                        Environment* env, VarManager* vars, ArrayManager* arrays,
                        std::vector< SubroutineManager::param_t >& params,
-                       size_t num_varargs, Environment::var* retval = nullptr );
+                       size_t num_varargs, Environment::var* retval = nullptr,
+                       std::shared_ptr< SubroutineManager::memo_t > memo = nullptr );
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+    uint64_t call( uint64_t* args ) override;
+
+    ASTNode::ptr clone_to_const() override;
+
+    bool is_pure() override;
+    bool is_bounded() override;
+
+    void check_dropped();
+
+    // calls of pure and bounded subroutines with constant arguments are executed at
+    // parse time, add_child() replaces them by their result
+    void fold_pure_call();
+
 private:
+    Bytecode::reg_t compile_inline( Bytecode& code, ASTNode* body );
+    uint64_t call_subroutine( const uint64_t* args );
+
     Environment* m_Env;
     VarManager* m_LocalVars;
     ArrayManager* m_LocalArrays;
@@ -192,6 +257,9 @@ private:
     // use weak_ptr for subroutine body to break circular references of recursive
     // calls, a shared_ptr to the body remains in class SubroutineManager
     std::weak_ptr<ASTNode> m_Body;
+
+    std::shared_ptr< SubroutineManager::memo_t > m_Memo;
+    uint64_t m_FoldedValue = 0;
 };
 
 
@@ -210,6 +278,10 @@ public:
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
     Environment::var* get_var();
 
 private:
@@ -257,14 +329,16 @@ public:
 
 	static size_t get_length( const Environment::array* array );
 	static std::string get_string( const Environment::array* array );
-	static void set_string( Environment::array* array, std::string str );
+	static void set_string( Environment::array* array, const std::string& str );
 
-private:
-	typedef union {
-		uint64_t integer;
-		uint8_t string[8];
-	} element_t;
+	// zero-copy access for the builtins, the characters returned by get_chars()
+	// are valid until the array is resized. set_string() and append_string()
+	// accept characters of the target array itself.
+	static const char* get_chars( const Environment::array* array, size_t& length );
+	static void set_string( Environment::array* array, const char* str, size_t length );
+	static void append_string( Environment::array* array, const char* str, size_t length );
 
+private:
     Environment::array* m_Array;
     std::string m_String;
 };
@@ -309,6 +383,10 @@ public:
 	ASTNodeIf( const yylloc_t& yylloc, ASTNode::ptr condition, ASTNode::ptr then_block, ASTNode::ptr else_block  );
 
 	uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
 };
 
 
@@ -320,9 +398,17 @@ class ASTNodeWhile : public ASTNode {
 public:
     typedef std::shared_ptr<ASTNodeWhile> ptr;
 
-	ASTNodeWhile( const yylloc_t& yylloc, ASTNode::ptr condition, ASTNode::ptr block );
+	ASTNodeWhile( const yylloc_t& yylloc, Environment* env, ASTNode::ptr condition, ASTNode::ptr block );
 
 	uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+    bool is_bounded() override;
+
+private:
+    Environment* m_Env;
 };
 
 
@@ -334,16 +420,93 @@ class ASTNodeFor : public ASTNode {
 public:
     typedef std::shared_ptr<ASTNodeFor> ptr;
 
-    ASTNodeFor( const yylloc_t& yylloc, ASTNodeAssign::ptr var, ASTNode::ptr to );
-    ASTNodeFor( const yylloc_t& yylloc, ASTNodeAssign::ptr var, ASTNode::ptr to, ASTNode::ptr step );
+    ASTNodeFor( const yylloc_t& yylloc, Environment* env, ASTNodeAssign::ptr var, ASTNode::ptr to );
+    ASTNodeFor( const yylloc_t& yylloc, Environment* env, ASTNodeAssign::ptr var, ASTNode::ptr to, ASTNode::ptr step );
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+    bool is_bounded() override;
+
 private:
+    Environment* m_Env;
     Environment::var* m_Var;
 };
 
 
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodeEvery
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNodeEvery : public ASTNode {
+public:
+    typedef std::shared_ptr<ASTNodeEvery> ptr;
+
+    // an overrun either skips the missed periods or runs them without sleeping
+    enum { POLICY_SKIP, POLICY_CATCH_UP };
+
+    // layout of the statistics array
+    enum { STAT_RUNS, STAT_OVERRUNS, STAT_SKIPPED, STAT_MIN_LATENESS, STAT_AVG_LATENESS, STAT_MAX_LATENESS, NUM_STATS };
+
+    ASTNodeEvery( const yylloc_t& yylloc, Environment* env, ASTNode::ptr period, int policy );
+    ASTNodeEvery( const yylloc_t& yylloc, Environment* env, ASTNode::ptr period, int policy, std::string stats );
+
+    uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
+    uint64_t call( uint64_t* args ) override;
+
+    bool is_bounded() override;
+
+private:
+    enum { CALL_START, CALL_WAIT };
+
+    // the schedule of one execution of the loop, kept on the stack of execute()
+    // or in registers of the bytecode frame, so that a recursive call running
+    // the same loop gets its own. The deadlines are multiples of the period
+    // after the epoch, all times are CLOCK_MONOTONIC nanoseconds
+    struct schedule_t {
+        uint64_t period;
+        uint64_t deadline;
+
+        uint64_t num_runs;
+        uint64_t num_overruns;
+        uint64_t num_skipped;
+        uint64_t min_lateness;
+        uint64_t max_lateness;
+        uint64_t sum_lateness;
+    };
+
+    static const size_t NUM_SCHEDULE_REGS = sizeof( schedule_t ) / sizeof( uint64_t );
+
+    void start( schedule_t& schedule, uint64_t period );
+    void wait( schedule_t& schedule );
+    void update_stats( const schedule_t& schedule );
+
+    Environment* m_Env;
+    Environment::array* m_Stats = nullptr;
+    int m_Policy;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodeGuard
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNodeGuard : public ASTNode {
+public:
+    typedef std::shared_ptr<ASTNodeGuard> ptr;
+
+    ASTNodeGuard( const yylloc_t& yylloc, ASTNode::ptr block );
+
+    uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
+};
+
+
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodePeek
 //////////////////////////////////////////////////////////////////////////////
@@ -356,11 +519,16 @@ public:
 
 	uint64_t execute() override;
 
-private:
-	template< typename T> uint64_t peek();
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+	template< typename T> uint64_t peek( void* address );
+	template< typename T> uint64_t peek_unchecked( void* address );
 
+private:
 	Environment* m_Env;
 	int m_SizeRestriction;
+
+	MappingCache m_Mapping;
 };
 
 
@@ -377,11 +545,89 @@ public:
 
 	uint64_t execute() override;
 
-private:
-	template< typename T> void poke();
+    Bytecode::reg_t compile( Bytecode& code ) override;
 
+	template< typename T> void poke( void* address, T value );
+	template< typename T> void poke( void* address, T value, T mask );
+	template< typename T> void poke_unchecked( void* address, T value );
+	template< typename T> void poke_unchecked( void* address, T value, T mask );
+
+private:
     Environment* m_Env;
 	int m_SizeRestriction;
+
+	MappingCache m_Mapping;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePeekBlock
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNodePeekBlock : public ASTNode {
+public:
+    typedef std::shared_ptr<ASTNodePeekBlock> ptr;
+
+    ASTNodePeekBlock( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr address, ASTNode::ptr count, int size_restriction );
+
+    uint64_t execute() override;
+
+private:
+    template< typename T> void peek_block( void* address, uint64_t count );
+
+    Environment::array* m_Array;
+    int m_SizeRestriction;
+
+    MappingCache m_Mapping;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePokeBlock
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNodePokeBlock : public ASTNode {
+public:
+    typedef std::shared_ptr<ASTNodePokeBlock> ptr;
+
+    ASTNodePokeBlock( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, std::string name, ASTNode::ptr count, int size_restriction );
+
+    uint64_t execute() override;
+
+private:
+    template< typename T> void poke_block( void* address, uint64_t count );
+
+    Environment::array* m_Array;
+    int m_SizeRestriction;
+
+    MappingCache m_Mapping;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodeMemFind
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTNodeMemFind : public ASTNode {
+public:
+    typedef std::shared_ptr<ASTNodeMemFind> ptr;
+
+    // without a name the node returns the address of the first match or -1,
+    // with a name it stores the addresses of all matches in the array
+    ASTNodeMemFind( const yylloc_t& yylloc, Environment* env, ASTNode::ptr address, ASTNode::ptr count, ASTNode::ptr value,
+                    ASTNode::ptr mask, int size_restriction );
+    ASTNodeMemFind( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr address, ASTNode::ptr count,
+                    ASTNode::ptr value, ASTNode::ptr mask, int size_restriction );
+
+    uint64_t execute() override;
+
+private:
+    template< typename T> uint64_t mem_find( void* address, uint64_t count, uint64_t value, uint64_t mask );
+
+    Environment::array* m_Array = nullptr;
+    int m_SizeRestriction;
+
+    MappingCache m_Mapping;
 };
 
 
@@ -427,8 +673,8 @@ public:
 	static int size_to_mod( int size );
 
 private:
-	static void print_value( std::ostream& out, uint64_t value, int modifier );
-	static void print_array( std::ostream& out, Environment::array* array, int modifier );
+	static void print_value( PrintBuffer& out, uint64_t value, int modifier );
+	static void print_array( PrintBuffer& out, Environment::array* array, int modifier );
 
 	typedef struct {
 		ASTNode::ptr node;
@@ -477,6 +723,8 @@ public:
 	ASTNodeDef( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr address, std::string from );
 
 	uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
 };
 
 
@@ -488,12 +736,15 @@ class ASTNodeDim : public ASTNode {
 public:
     typedef std::shared_ptr<ASTNodeDim> ptr;
 
-    ASTNodeDim( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr size );
+    ASTNodeDim( const yylloc_t& yylloc, Environment* env, std::string name, ASTNode::ptr size, int size_restriction = 0 );
 
     uint64_t execute() override;
 
 private:
     Environment::array* m_Array;
+
+    // element width in bytes, 0 keeps the width of the array
+    unsigned m_Width = 0;
 };
 
 
@@ -512,6 +763,8 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
 private:
     ASTNodeMap( const yylloc_t& yylloc, Environment* env, uint64_t address, uint64_t size, std::string device );
     ASTNodeMap( const yylloc_t& yylloc, Environment* env, uint64_t address, uint64_t at, uint64_t size, std::string device );
@@ -529,6 +782,11 @@ public:
 	ASTNodeImport( const yylloc_t& yylloc, Environment* env, std::string file, bool run_once );
 
 	uint64_t execute() override;
+
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+private:
+    Environment* m_Env;
 };
 
 
@@ -544,6 +802,10 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
     ASTNode::ptr clone_to_const() override;
 
 private:
@@ -563,6 +825,10 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
 	ASTNode::ptr clone_to_const() override;
 
 private:
@@ -582,6 +848,10 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
 private:
 	int m_SizeRestriction;
 };
@@ -599,6 +869,10 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
 private:
 	const Environment::var* m_Var;
 };
@@ -640,6 +914,12 @@ public:
 
     uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
+    uint64_t get_address( uint64_t index );
+
 private:
     const Environment::var* m_Var;
 };
@@ -659,6 +939,8 @@ public:
     uint64_t execute() override;
     bool get_array_result( Environment::array*& array ) override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
 private:
     Environment::array* m_Array;
 };
@@ -677,6 +959,10 @@ public:
 
 	uint64_t execute() override;
 
+    Bytecode::reg_t compile( Bytecode& code ) override;
+
+    bool is_pure() override;
+
 private:
     uint64_t m_Value;
 };
@@ -726,6 +1012,12 @@ inline uint64_t ASTNode::compiletime_execute( ASTNode::ptr node )
 	return compiletime_execute( node.get() );
 }
 
+template< typename T, typename... ARGS >
+inline std::shared_ptr< T > make_node( ARGS&&... args )
+{
+    return std::allocate_shared< T >( ASTArena::allocator< T >( ASTArena::get_current() ), std::forward< ARGS >( args )... );
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class ASTNodeBuiltin template functions
@@ -737,7 +1029,8 @@ template< size_t NUM_ARGS, uint32_t SIGNATURE >
 inline ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::ASTNodeBuiltin( const yylloc_t& yylloc, Environment* env, const arglist_t& args,
 		                                                      std::function< uint64_t( const args_t& ) > builtin, bool is_const )
  : ASTNode( yylloc ),
-   m_Builtin( builtin )
+   m_Builtin( builtin ),
+   m_IsPure( is_const )
 {
 #ifdef ASTDEBUG
     std::cerr << "AST[" << this << "]: creating ASTNodeBuiltin<" << NUM_ARGS << "," << std::hex << SIGNATURE << std::dec << ">" << std::endl;
@@ -754,7 +1047,7 @@ inline ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::ASTNodeBuiltin( const yylloc_t& yy
         else {
         	if( (SIGNATURE & (1 << i)) == 0 ) throw ASTExceptionSyntaxError( yylloc );
         	if( args[i].first ) add_child( args[i].first );
-        	else add_child( std::make_shared<ASTNodeArray>( yylloc, env, args[i].second ) );
+        	else add_child( make_node<ASTNodeArray>( yylloc, env, args[i].second ) );
         	is_const = false;
         }
     }
@@ -771,13 +1064,25 @@ inline uint64_t ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::execute()
 
     assert( get_children().size() == NUM_ARGS );
 
+    uint64_t values[ NUM_ARGS + 1 ];
+    for( size_t i = 0; i < NUM_ARGS; i++ ) values[i] = get_children()[i]->execute();
+
+    return call( values );
+}
+
+template< size_t NUM_ARGS, uint32_t SIGNATURE >
+inline Bytecode::reg_t ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::compile( Bytecode& code )
+{
+    return compile_call( code );
+}
+
+template< size_t NUM_ARGS, uint32_t SIGNATURE >
+inline uint64_t ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::call( uint64_t* values )
+{
     args_t args;
     for( size_t i = 0; i < NUM_ARGS; i++ ) {
-    	if( (SIGNATURE & (1 << i)) ) {
-    		get_children()[i]->execute();
-    		get_children()[i]->get_array_result( args[i].array );
-    	}
-    	else args[i].value = get_children()[i]->execute();
+    	if( (SIGNATURE & (1 << i)) ) get_children()[i]->get_array_result( args[i].array );
+    	else args[i].value = values[i];
     }
     return m_Builtin( args );
 }
@@ -791,7 +1096,91 @@ inline ASTNode::ptr ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::clone_to_const()
     std::cerr << "AST[" << this << "]: running const optimization" << std::endl;
 #endif
 
-    return std::make_shared<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
+    return make_node<ASTNodeConstant>( get_location(), compiletime_execute( this ) );
+}
+
+template< size_t NUM_ARGS, uint32_t SIGNATURE >
+inline bool ASTNodeBuiltin< NUM_ARGS, SIGNATURE >::is_pure()
+{
+    // builtins which may be folded with constant arguments are pure
+    return m_IsPure && has_pure_children();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePeek template functions
+//////////////////////////////////////////////////////////////////////////////
+
+template< typename T >
+inline uint64_t ASTNodePeek::peek( void* address )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+    if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+    uint64_t ret = mmap->peek<T>( address );
+    if( mmap->has_failed() ) throw ASTExceptionBusError( get_location(), address, sizeof(T) );
+
+    return ret;
+}
+
+template< typename T >
+inline uint64_t ASTNodePeek::peek_unchecked( void* address )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+    if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+    return mmap->peek_unchecked<T>( address );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class ASTNodePoke template functions
+//////////////////////////////////////////////////////////////////////////////
+
+template< typename T >
+inline void ASTNodePoke::poke( void* address, T value )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+	if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+	mmap->poke<T>( address, value );
+
+    if( mmap->has_failed() ) throw ASTExceptionBusError( get_location(), address, sizeof(T) );
+}
+
+template< typename T >
+inline void ASTNodePoke::poke( void* address, T value, T mask )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+	if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+	mmap->modify<T>( address, value, mask );
+
+    if( mmap->has_failed() ) throw ASTExceptionBusError( get_location(), address, sizeof(T) );
+}
+
+template< typename T >
+inline void ASTNodePoke::poke_unchecked( void* address, T value )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+	if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+	mmap->poke_unchecked<T>( address, value );
+}
+
+template< typename T >
+inline void ASTNodePoke::poke_unchecked( void* address, T value, T mask )
+{
+	MMap* mmap = m_Mapping.get( address, sizeof(T) );
+
+	if( !mmap ) throw ASTExceptionNoMapping( get_location(), address, sizeof(T) );
+
+	mmap->modify_unchecked<T>( address, value, mask );
 }
 
 
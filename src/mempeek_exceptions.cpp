@@ -59,7 +59,7 @@ void ASTException::loc( const yylloc_t& location )
 {
 	string str = "";
 
-    if( location.file != "" ) {
+    if( location.file && *location.file ) {
     	str += location.file;
     	str += ':';
     	str += to_string( location.first_line );
@@ -80,8 +80,6 @@ class ASTRuntimeException : public ASTException {};
 // ASTNode control flow exceptions
 //////////////////////////////////////////////////////////////////////////////
 
-class ASTExceptionExit : public ASTControlflowException {};
-class ASTExceptionBreak : public ASTControlflowException {};
 class ASTExceptionQuit : public ASTControlflowException {};
 class ASTExceptionTerminate : public ASTControlflowException {};
 
@@ -157,6 +155,15 @@ public:
     }
 };
 
+class ASTExceptionImpureFunction : public ASTCompileException {
+public:
+    ASTExceptionImpureFunction( const yylloc_t& location, std::string name )
+    {
+        loc( location );
+        msg( "function \"$0\" is not pure", name );
+    }
+};
+
 class ASTExceptionConstDivisionByZero : public ASTCompileException {
 public:
     ASTExceptionConstDivisionByZero( const ASTException& ex )
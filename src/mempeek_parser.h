@@ -49,8 +49,9 @@ typedef struct {
 
 typedef Environment* yyenv_t;
 
+// trivially copyable, file points to a name interned by Environment::intern_file_name()
 typedef struct {
-	std::string file;
+	const char* file;
 	int first_line;
 	int last_line;
 } yylloc_t;
@@ -0,0 +1,59 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "memscan.h"
+
+
+//////////////////////////////////////////////////////////////////////////////
+// memory scan implementation
+//////////////////////////////////////////////////////////////////////////////
+
+// memscan.o is always built with -O3 (see the Makefile). The blocks are
+// tested without an early exit, which lets the compiler auto-vectorize the
+// inner loop for the baseline instruction set of the target, e.g. SSE2 on
+// x86-64 without a -march option.
+template< typename T >
+size_t memscan( const T* data, size_t count, T value, T mask )
+{
+    const size_t BLOCK_SIZE = 256 / sizeof(T);
+
+    size_t block = 0;
+    for( ; block + BLOCK_SIZE <= count; block += BLOCK_SIZE ) {
+        T found = 0;
+        for( size_t i = block; i < block + BLOCK_SIZE; i++ ) found |= ( data[i] & mask ) == value;
+        if( found ) break;
+    }
+
+    for( size_t i = block; i < count; i++ ) {
+        if( ( data[i] & mask ) == value ) return i;
+    }
+
+    return count;
+}
+
+template size_t memscan< uint8_t >( const uint8_t*, size_t, uint8_t, uint8_t );
+template size_t memscan< uint16_t >( const uint16_t*, size_t, uint16_t, uint16_t );
+template size_t memscan< uint32_t >( const uint32_t*, size_t, uint32_t, uint32_t );
+template size_t memscan< uint64_t >( const uint64_t*, size_t, uint64_t, uint64_t );
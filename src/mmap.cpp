@@ -28,20 +28,136 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/sysmacros.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <ucontext.h>
 
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
 
+//////////////////////////////////////////////////////////////////////////////
+// access stubs with fault table
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef MMAP_FAULT_TABLE
+
+// Each stub consists of the entry with the memory access instruction at label
+// <name>_fault and the fixup code at label <name>_fixup. A load returns the
+// value and 0, a store returns 0. The fixup code returns 0 and 1 for a load
+// and 1 for a store.
+
+#define MMAP_STUB_LABEL( name ) \
+    ".globl " name "\n" \
+    ".hidden " name "\n" \
+    name ":\n"
+
+#define MMAP_STUB( name, access, success, failure ) \
+    ".type " name ", %function\n" \
+    MMAP_STUB_LABEL( name ) \
+    MMAP_STUB_LABEL( name "_fault" ) \
+    "    " access "\n" \
+    success \
+    MMAP_STUB_LABEL( name "_fixup" ) \
+    failure \
+    ".size " name ", . - " name "\n"
+
+#if defined( __x86_64__ )
+
+#define MMAP_LOAD_STUB( name, access ) \
+    MMAP_STUB( name, access, \
+        "    xorl %edx, %edx\n    ret\n", \
+        "    xorl %eax, %eax\n    movl $1, %edx\n    ret\n" )
+
+#define MMAP_STORE_STUB( name, access ) \
+    MMAP_STUB( name, access, \
+        "    xorl %eax, %eax\n    ret\n", \
+        "    movl $1, %eax\n    ret\n" )
+
+asm(
+    ".text\n"
+    MMAP_LOAD_STUB( "mmap_load8", "movzbl (%rdi), %eax" )
+    MMAP_LOAD_STUB( "mmap_load16", "movzwl (%rdi), %eax" )
+    MMAP_LOAD_STUB( "mmap_load32", "movl (%rdi), %eax" )
+    MMAP_LOAD_STUB( "mmap_load64", "movq (%rdi), %rax" )
+    MMAP_STORE_STUB( "mmap_store8", "movb %sil, (%rdi)" )
+    MMAP_STORE_STUB( "mmap_store16", "movw %si, (%rdi)" )
+    MMAP_STORE_STUB( "mmap_store32", "movl %esi, (%rdi)" )
+    MMAP_STORE_STUB( "mmap_store64", "movq %rsi, (%rdi)" )
+);
+
+#define MMAP_CONTEXT_PC( context ) ((ucontext_t*)(context))->uc_mcontext.gregs[ REG_RIP ]
+
+#elif defined( __aarch64__ )
+
+#define MMAP_LOAD_STUB( name, access ) \
+    MMAP_STUB( name, access, \
+        "    mov x1, #0\n    ret\n", \
+        "    mov x0, #0\n    mov x1, #1\n    ret\n" )
+
+#define MMAP_STORE_STUB( name, access ) \
+    MMAP_STUB( name, access, \
+        "    mov x0, #0\n    ret\n", \
+        "    mov x0, #1\n    ret\n" )
+
+asm(
+    ".text\n"
+    MMAP_LOAD_STUB( "mmap_load8", "ldrb w0, [x0]" )
+    MMAP_LOAD_STUB( "mmap_load16", "ldrh w0, [x0]" )
+    MMAP_LOAD_STUB( "mmap_load32", "ldr w0, [x0]" )
+    MMAP_LOAD_STUB( "mmap_load64", "ldr x0, [x0]" )
+    MMAP_STORE_STUB( "mmap_store8", "strb w1, [x0]" )
+    MMAP_STORE_STUB( "mmap_store16", "strh w1, [x0]" )
+    MMAP_STORE_STUB( "mmap_store32", "str w1, [x0]" )
+    MMAP_STORE_STUB( "mmap_store64", "str x1, [x0]" )
+);
+
+#define MMAP_CONTEXT_PC( context ) ((ucontext_t*)(context))->uc_mcontext.pc
+
+#endif
+
+extern "C" {
+
+extern const char mmap_load8_fault[], mmap_load8_fixup[];
+extern const char mmap_load16_fault[], mmap_load16_fixup[];
+extern const char mmap_load32_fault[], mmap_load32_fixup[];
+extern const char mmap_load64_fault[], mmap_load64_fixup[];
+extern const char mmap_store8_fault[], mmap_store8_fixup[];
+extern const char mmap_store16_fault[], mmap_store16_fixup[];
+extern const char mmap_store32_fault[], mmap_store32_fixup[];
+extern const char mmap_store64_fault[], mmap_store64_fixup[];
+
+}
+
+static const struct {
+    const char* fault;
+    const char* fixup;
+} s_FaultTable[] = {
+    { mmap_load8_fault, mmap_load8_fixup },
+    { mmap_load16_fault, mmap_load16_fixup },
+    { mmap_load32_fault, mmap_load32_fixup },
+    { mmap_load64_fault, mmap_load64_fixup },
+    { mmap_store8_fault, mmap_store8_fixup },
+    { mmap_store16_fault, mmap_store16_fixup },
+    { mmap_store32_fault, mmap_store32_fixup },
+    { mmap_store64_fault, mmap_store64_fixup }
+};
+
+#endif
+
+
 //////////////////////////////////////////////////////////////////////////////
 // class MMap implementation
 //////////////////////////////////////////////////////////////////////////////
 
-sig_atomic_t MMap::s_SignalEnable = 0;
-sigjmp_buf MMap::s_SignalRecovery;
+#ifndef MMAP_FAULT_TABLE
+sigjmp_buf* volatile MMap::s_SignalRecovery = nullptr;
+#endif
+
+void* volatile MMap::s_FaultAddress = nullptr;
+volatile size_t MMap::s_FaultSize = 0;
 
 
 MMap* MMap::create( void* phys_addr, size_t size )
@@ -71,6 +187,14 @@ MMap* MMap::create( void* phys_addr, size_t size, const char* device )
 
     mmap->m_VirtAddr = ::mmap( 0, mmap->m_MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, page_addr );
 
+    // a regular file covering the whole mapping or /dev/zero cannot raise a bus
+    // error, everything else is treated as device memory
+    struct stat st;
+    if( fstat( fd, &st ) == 0 ) {
+        if( S_ISREG( st.st_mode ) ) mmap->m_IsMemory = (uint64_t)st.st_size >= page_addr + mmap->m_MappingSize;
+        else if( S_ISCHR( st.st_mode ) ) mmap->m_IsMemory = st.st_rdev == makedev( 1, 5 );
+    }
+
     close(fd);
 
     if( mmap->m_VirtAddr == MAP_FAILED ) {
@@ -88,13 +212,16 @@ MMap::~MMap()
 
 void MMap::enable_signal_handler()
 {
-    s_SignalEnable = 0;
+#ifndef MMAP_FAULT_TABLE
+    s_SignalRecovery = nullptr;
+#endif
 
     struct sigaction sa;
 
+    // SA_NODEFER keeps SIGBUS unblocked after siglongjmp() leaves the handler
     sigemptyset( &sa.sa_mask );
-    sa.sa_flags = 0;
-    sa.sa_handler = signal_handler;
+    sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sa.sa_sigaction = signal_handler;
 
     sigaction( SIGBUS, &sa, nullptr );
 }
@@ -110,7 +237,37 @@ void MMap::disable_signal_handler()
     sigaction( SIGBUS, &sa, nullptr );
 }
 
-void MMap::signal_handler( int )
+#ifdef MMAP_FAULT_TABLE
+
+void MMap::signal_handler( int, siginfo_t*, void* context )
 {
-    if( s_SignalEnable ) siglongjmp( s_SignalRecovery, 1);
+    const char* pc = (const char*)MMAP_CONTEXT_PC( context );
+
+    for( const auto& entry: s_FaultTable ) {
+        if( pc == entry.fault ) {
+            MMAP_CONTEXT_PC( context ) = (uintptr_t)entry.fixup;
+            return;
+        }
+    }
+
+    // not caused by an access stub, let the fault kill the process
+    signal( SIGBUS, SIG_DFL );
 }
+
+void MMap::throw_fault( void* phys_addr, size_t size )
+{
+    s_FaultAddress = phys_addr;
+    s_FaultSize = size;
+
+    throw fault();
+}
+
+#else
+
+void MMap::signal_handler( int, siginfo_t*, void* )
+{
+    sigjmp_buf* recovery = s_SignalRecovery;
+    if( recovery ) siglongjmp( *recovery, 1 );
+}
+
+#endif
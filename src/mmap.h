@@ -26,12 +26,48 @@
 #ifndef __mmap_h__
 #define __mmap_h__
 
+#include "memscan.h"
+
 #include <stdint.h>
 #include <stddef.h>
 #include <setjmp.h>
 #include <signal.h>
 
 
+//////////////////////////////////////////////////////////////////////////////
+// access stubs with fault table
+//////////////////////////////////////////////////////////////////////////////
+
+// With USE_FAULT_TABLE on a supported architecture every memory access goes
+// through a small assembler stub. The SIGBUS handler looks up the faulting
+// stub instruction and resumes at the stub's fixup code, which reports the
+// failure. Otherwise sigsetjmp / siglongjmp is used for recovery.
+
+#if defined( USE_FAULT_TABLE ) && (defined( __x86_64__ ) || defined( __aarch64__ ))
+#define MMAP_FAULT_TABLE
+
+extern "C" {
+
+typedef struct {
+    uint64_t value;
+    uint64_t failed;
+} mmap_load_t;
+
+mmap_load_t mmap_load8( const volatile void* address );
+mmap_load_t mmap_load16( const volatile void* address );
+mmap_load_t mmap_load32( const volatile void* address );
+mmap_load_t mmap_load64( const volatile void* address );
+
+uint64_t mmap_store8( volatile void* address, uint64_t value );
+uint64_t mmap_store16( volatile void* address, uint64_t value );
+uint64_t mmap_store32( volatile void* address, uint64_t value );
+uint64_t mmap_store64( volatile void* address, uint64_t value );
+
+}
+
+#endif
+
+
 //////////////////////////////////////////////////////////////////////////////
 // class MMap
 //////////////////////////////////////////////////////////////////////////////
@@ -48,14 +84,44 @@ public:
 	void* get_base_address();
 	size_t get_size();
 
+	bool contains( void* phys_addr, size_t size );
+
     bool has_failed();
 
+    // true if the mapping is plain memory, e.g. a file or /dev/zero, which
+    // may be read with any instructions instead of one access per element
+    bool is_memory();
+
+    // direct pointer to plain memory for bulk reads, nullptr for device memory
+    const void* get_memory( void* phys_addr );
+
 	template< typename T > T peek( void* phys_addr );
 	template< typename T > void poke( void* phys_addr, T value );
 
 	template< typename T > void set( void* phys_addr, T value );
 	template< typename T > void clear( void* phys_addr, T value );
 	template< typename T > void toggle( void* phys_addr, T value );
+	template< typename T > void modify( void* phys_addr, T value, T mask );
+
+	// block transfers with one access of size T per element, all within one guard()
+	template< typename T, typename E > bool read_block( void* phys_addr, E* values, size_t count );
+	template< typename T, typename E > bool write_block( void* phys_addr, const E* values, size_t count );
+
+	// search for elements with ( element & mask ) == value within one guard(), found( index )
+	// is called for each match in ascending order and returns false to stop the search
+	template< typename T, typename F > bool find_block( void* phys_addr, size_t count, T value, T mask, F found );
+
+	// batched access: guard() arms the bus error recovery once and runs func, which
+	// uses the unchecked accessors below. On a bus error guard() returns false and
+	// get_fault_address() / get_fault_size() describe the failed access.
+	template< typename F > static bool guard( F func );
+
+	template< typename T > T peek_unchecked( void* phys_addr );
+	template< typename T > void poke_unchecked( void* phys_addr, T value );
+	template< typename T > void modify_unchecked( void* phys_addr, T value, T mask );
+
+	static void* get_fault_address();
+	static size_t get_fault_size();
 
 	static void enable_signal_handler();
 	static void disable_signal_handler();
@@ -63,7 +129,18 @@ public:
 private:
 	MMap() {}
 
-	static void signal_handler( int );
+	static void signal_handler( int, siginfo_t* info, void* context );
+
+	template< typename T > volatile T* get_virt_address( void* phys_addr );
+
+	template< typename T > static bool load( volatile T* virt_addr, T& value );
+	template< typename T > static bool store( volatile T* virt_addr, T value );
+
+#ifdef MMAP_FAULT_TABLE
+	class fault {};
+
+	[[noreturn]] static void throw_fault( void* phys_addr, size_t size );
+#endif
 
 	uintptr_t m_PhysAddr;
 	size_t m_Size;
@@ -73,9 +150,14 @@ private:
 	size_t m_MappingSize;
 
 	bool m_HasFailed = false;
+	bool m_IsMemory = false;
 
-	static sig_atomic_t s_SignalEnable;
-	static sigjmp_buf s_SignalRecovery;
+#ifndef MMAP_FAULT_TABLE
+	static sigjmp_buf* volatile s_SignalRecovery;
+#endif
+
+	static void* volatile s_FaultAddress;
+	static volatile size_t s_FaultSize;
 
 	MMap( const MMap& ) = delete;
 	MMap& operator=( const MMap& ) = delete;
@@ -101,83 +183,269 @@ inline size_t MMap::get_size()
 	return m_Size;
 }
 
+inline bool MMap::contains( void* phys_addr, size_t size )
+{
+    return (uintptr_t)phys_addr >= m_PhysAddr && (uintptr_t)phys_addr - m_PhysAddr + size <= m_Size;
+}
+
 inline bool MMap::has_failed()
 {
     return m_HasFailed;
 }
 
+inline bool MMap::is_memory()
+{
+    return m_IsMemory;
+}
+
+inline void* MMap::get_fault_address()
+{
+    return s_FaultAddress;
+}
+
+inline size_t MMap::get_fault_size()
+{
+    return s_FaultSize;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class MMap template functions
 //////////////////////////////////////////////////////////////////////////////
 
+#ifdef MMAP_FAULT_TABLE
+
+template< typename F >
+inline bool MMap::guard( F func )
+{
+    // the unchecked accessors throw on a failed access, nothing to arm here
+    try {
+        func();
+    }
+    catch( const fault& ) {
+        return false;
+    }
+
+    return true;
+}
+
 template< typename T >
-inline T MMap::peek( void* phys_addr )
+inline bool MMap::load( volatile T* virt_addr, T& value )
 {
-	uintptr_t offset = (uintptr_t)phys_addr - m_PhysAddr + m_PageOffset;
-	volatile T* virt_addr = (T*)((uint8_t*)m_VirtAddr + offset);
+    mmap_load_t ret;
 
-	T ret = 0;
+    switch( sizeof(T) ) {
+    case 1: ret = mmap_load8( virt_addr ); break;
+    case 2: ret = mmap_load16( virt_addr ); break;
+    case 4: ret = mmap_load32( virt_addr ); break;
+    default: ret = mmap_load64( virt_addr ); break;
+    }
 
-    m_HasFailed = false;
-    s_SignalEnable = 1;
-    if( sigsetjmp( s_SignalRecovery, 1 ) == 0 ) ret = *virt_addr;
-    else m_HasFailed = true;
-    s_SignalEnable = 0;
+    value = (T)ret.value;
+    return ret.failed == 0;
+}
 
-	return ret;
+template< typename T >
+inline bool MMap::store( volatile T* virt_addr, T value )
+{
+    switch( sizeof(T) ) {
+    case 1: return mmap_store8( virt_addr, value ) == 0;
+    case 2: return mmap_store16( virt_addr, value ) == 0;
+    case 4: return mmap_store32( virt_addr, value ) == 0;
+    default: return mmap_store64( virt_addr, value ) == 0;
+    }
 }
 
 template< typename T >
-inline void MMap::poke( void* phys_addr, T value )
+inline T MMap::peek_unchecked( void* phys_addr )
 {
-	uintptr_t offset = (uintptr_t)phys_addr - m_PhysAddr + m_PageOffset;
-	volatile T* virt_addr = (T*)((uint8_t*)m_VirtAddr + offset);
+    T value;
+    if( !load<T>( get_virt_address<T>( phys_addr ), value ) ) throw_fault( phys_addr, sizeof(T) );
+    return value;
+}
 
-	m_HasFailed = false;
-	s_SignalEnable = 1;
-    if( sigsetjmp( s_SignalRecovery, 1 ) == 0 ) *virt_addr = value;
-    else m_HasFailed = true;
-    s_SignalEnable = 0;
+template< typename T >
+inline void MMap::poke_unchecked( void* phys_addr, T value )
+{
+    if( !store<T>( get_virt_address<T>( phys_addr ), value ) ) throw_fault( phys_addr, sizeof(T) );
 }
 
 template< typename T >
-inline void MMap::set( void* phys_addr, T value )
+inline void MMap::modify_unchecked( void* phys_addr, T value, T mask )
 {
-	uintptr_t offset = (uintptr_t)phys_addr - m_PhysAddr + m_PageOffset;
-	volatile T* virt_addr = (T*)((uint8_t*)m_VirtAddr + offset);
+    volatile T* virt_addr = get_virt_address<T>( phys_addr );
 
-    m_HasFailed = false;
-    s_SignalEnable = 1;
-    if( sigsetjmp( s_SignalRecovery, 1 ) == 0 ) *virt_addr |= value;
-    else m_HasFailed = true;
-    s_SignalEnable = 0;
+    T old_value;
+    if( !load<T>( virt_addr, old_value ) ) throw_fault( phys_addr, sizeof(T) );
+    if( !store<T>( virt_addr, (old_value & ~mask) | (value & mask) ) ) throw_fault( phys_addr, sizeof(T) );
+}
+
+#else
+
+template< typename F >
+bool MMap::guard( F func )
+{
+    // the signal handler is installed with SA_NODEFER, so the signal mask
+    // needs no restore and sigsetjmp can skip the sigprocmask syscall
+    sigjmp_buf recovery;
+    sigjmp_buf* const outer = s_SignalRecovery;
+
+    if( sigsetjmp( recovery, 0 ) != 0 ) {
+        s_SignalRecovery = outer;
+        return false;
+    }
+
+    s_SignalRecovery = &recovery;
+
+    try {
+        func();
+    }
+    catch( ... ) {
+        s_SignalRecovery = outer;
+        throw;
+    }
+
+    s_SignalRecovery = outer;
+    return true;
 }
 
 template< typename T >
-inline void MMap::clear( void* phys_addr, T value )
+inline bool MMap::load( volatile T* virt_addr, T& value )
+{
+    return guard( [&] { value = *virt_addr; } );
+}
+
+template< typename T >
+inline bool MMap::store( volatile T* virt_addr, T value )
+{
+    return guard( [&] { *virt_addr = value; } );
+}
+
+template< typename T >
+inline T MMap::peek_unchecked( void* phys_addr )
+{
+    s_FaultAddress = phys_addr;
+    s_FaultSize = sizeof(T);
+
+    return *get_virt_address<T>( phys_addr );
+}
+
+template< typename T >
+inline void MMap::poke_unchecked( void* phys_addr, T value )
+{
+    s_FaultAddress = phys_addr;
+    s_FaultSize = sizeof(T);
+
+    *get_virt_address<T>( phys_addr ) = value;
+}
+
+template< typename T >
+inline void MMap::modify_unchecked( void* phys_addr, T value, T mask )
+{
+    s_FaultAddress = phys_addr;
+    s_FaultSize = sizeof(T);
+
+    volatile T* virt_addr = get_virt_address<T>( phys_addr );
+    *virt_addr = (*virt_addr & ~mask) | (value & mask);
+}
+
+#endif
+
+template< typename T >
+inline volatile T* MMap::get_virt_address( void* phys_addr )
 {
 	uintptr_t offset = (uintptr_t)phys_addr - m_PhysAddr + m_PageOffset;
-	volatile T* virt_addr = (T*)((uint8_t*)m_VirtAddr + offset);
+	return (T*)((uint8_t*)m_VirtAddr + offset);
+}
 
-    m_HasFailed = false;
-    s_SignalEnable = 1;
-    if( sigsetjmp( s_SignalRecovery, 1 ) == 0 ) *virt_addr &= ~value;
-    else m_HasFailed = true;
-    s_SignalEnable = 0;
+inline const void* MMap::get_memory( void* phys_addr )
+{
+    return m_IsMemory ? (const void*)get_virt_address< uint8_t >( phys_addr ) : nullptr;
+}
+
+template< typename T >
+inline T MMap::peek( void* phys_addr )
+{
+	T ret = 0;
+	m_HasFailed = !load<T>( get_virt_address<T>( phys_addr ), ret );
+	return m_HasFailed ? 0 : ret;
+}
+
+template< typename T >
+inline void MMap::poke( void* phys_addr, T value )
+{
+	m_HasFailed = !store<T>( get_virt_address<T>( phys_addr ), value );
+}
+
+template< typename T >
+inline void MMap::set( void* phys_addr, T value )
+{
+	modify<T>( phys_addr, value, value );
+}
+
+template< typename T >
+inline void MMap::clear( void* phys_addr, T value )
+{
+	modify<T>( phys_addr, 0, value );
 }
 
 template< typename T >
 inline void MMap::toggle( void* phys_addr, T value )
 {
-	uintptr_t offset = (uintptr_t)phys_addr - m_PhysAddr + m_PageOffset;
-	volatile T* virt_addr = (T*)((uint8_t*)m_VirtAddr + offset);
+	volatile T* virt_addr = get_virt_address<T>( phys_addr );
+
+	T old_value;
+	m_HasFailed = !load<T>( virt_addr, old_value ) || !store<T>( virt_addr, old_value ^ value );
+}
+
+template< typename T >
+inline void MMap::modify( void* phys_addr, T value, T mask )
+{
+	volatile T* virt_addr = get_virt_address<T>( phys_addr );
+
+	T old_value;
+	m_HasFailed = !load<T>( virt_addr, old_value ) || !store<T>( virt_addr, (old_value & ~mask) | (value & mask) );
+}
 
-    m_HasFailed = false;
-    s_SignalEnable = 1;
-    if( sigsetjmp( s_SignalRecovery, 1 ) == 0 ) *virt_addr ^= value;
-    else m_HasFailed = true;
-    s_SignalEnable = 0;
+template< typename T, typename E >
+inline bool MMap::read_block( void* phys_addr, E* values, size_t count )
+{
+	return guard( [&] {
+	    uint8_t* address = (uint8_t*)phys_addr;
+	    for( size_t i = 0; i < count; i++, address += sizeof(T) ) values[i] = (E)peek_unchecked<T>( address );
+	});
+}
+
+template< typename T, typename E >
+inline bool MMap::write_block( void* phys_addr, const E* values, size_t count )
+{
+	return guard( [&] {
+	    uint8_t* address = (uint8_t*)phys_addr;
+	    for( size_t i = 0; i < count; i++, address += sizeof(T) ) poke_unchecked<T>( address, (T)values[i] );
+	});
+}
+
+template< typename T, typename F >
+inline bool MMap::find_block( void* phys_addr, size_t count, T value, T mask, F found )
+{
+	return guard( [&] {
+	    const T* data = (const T*)get_virt_address<T>( phys_addr );
+
+	    if( m_IsMemory && (uintptr_t)data % sizeof(T) == 0 ) {
+	        // plain memory is scanned with the vectorized kernel
+	        for( size_t i = memscan<T>( data, count, value, mask ); i < count; ) {
+	            if( !found( i ) ) break;
+	            i += 1 + memscan<T>( data + i + 1, count - i - 1, value, mask );
+	        }
+	    }
+	    else {
+	        // device memory needs exactly one access of size T per element
+	        uint8_t* address = (uint8_t*)phys_addr;
+	        for( size_t i = 0; i < count; i++, address += sizeof(T) ) {
+	            if( ( peek_unchecked<T>( address ) & mask ) == value && !found( i ) ) break;
+	        }
+	    }
+	});
 }
 
 
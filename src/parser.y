@@ -39,6 +39,7 @@ static size_t arrayarg_depth = 0;
 
 static ASTNodePrint::ptr printnode = nullptr;
 
+// the scanner is a TokenStream, see tokencache.h
 int yylex( yyvalue_t*, YYLTYPE*, yyscan_t );
 
 void yyerror( YYLTYPE* yylloc, yyscan_t, yyenv_t, yynodeptr_t&, const char* ) { throw ASTExceptionSyntaxError( *yylloc ); }
@@ -74,7 +75,7 @@ arglist_t::value_type yystringarg( const yylloc_t& location, Environment* env, s
 {
     string result = "@arg" + to_string( arrayarg_counter++ );
     env->alloc_array( result );
-    ASTNode::ptr node = make_shared<ASTNodeString>( location, env, result, value );
+    ASTNode::ptr node = make_node<ASTNodeString>( location, env, result, value );
     return make_pair( node, result );
 }
 
@@ -96,13 +97,16 @@ arglist_t::value_type yystringarg( const yylloc_t& location, Environment* env, s
 %token T_IMPORT T_RUN
 %token T_PEEK
 %token T_POKE T_MASK
+%token T_PEEKBLOCK T_POKEBLOCK T_MEMFIND
 %token T_IF T_THEN T_ELSE T_ENDIF
 %token T_WHILE T_DO T_ENDWHILE
 %token T_FOR T_TO T_STEP T_ENDFOR
+%token T_EVERY T_CATCHUP T_ENDEVERY
+%token T_GUARD T_ENDGUARD
 %token T_PRINT T_DEC T_HEX T_BIN T_NEG T_FLOAT T_ARRAY T_STRING T_NOENDL
 %token T_SLEEP T_UNTIL T_NOW
 %token T_BREAK T_QUIT
-%token T_PRAGMA T_WORDSIZE T_LOADPATH
+%token T_PRAGMA T_WORDSIZE T_LOADPATH T_MEMOIZE
 
 %token T_BIT_NOT T_LOG_NOT T_BIT_AND T_LOG_AND T_BIT_XOR T_LOG_XOR T_BIT_OR T_LOG_OR
 %token T_LSHIFT T_RSHIFT T_PLUS T_MINUS T_MUL T_DIV T_MOD T_SDIV T_SMOD
@@ -127,15 +131,15 @@ arglist_t::value_type yystringarg( const yylloc_t& location, Environment* env, s
 start : toplevel_block                                  { yyroot = $1.node; }
       ;
 
-toplevel_block : toplevel_statement                     { $$.node = make_shared<ASTNodeBlock>( @$, env ); $$.node->add_child( $1.node ); }
+toplevel_block : toplevel_statement                     { $$.node = make_node<ASTNodeBlock>( @$, env ); $$.node->add_child( $1.node ); }
                | toplevel_block toplevel_statement      { $$.node = $1.node; $$.node->add_child( $2.node ); }
                ;
 
-block : statement                                       { $$.node = make_shared<ASTNodeBlock>( @$, env ); $$.node->add_child( $1.node ); }
+block : statement                                       { $$.node = make_node<ASTNodeBlock>( @$, env ); $$.node->add_child( $1.node ); }
       | block statement                                 { $$.node = $1.node; $$.node->add_child( $2.node ); }
       ;
 
-subroutine_block :                                          { $$.node = make_shared<ASTNodeBlock>( @$, env ); env->set_subroutine_body( $$.node ); }
+subroutine_block :                                          { $$.node = make_node<ASTNodeBlock>( @$, env ); env->set_subroutine_body( $$.node ); }
                    subroutine_statement                     { $$.node = $1.node; $$.node->add_child( $2.node ); }
                  | subroutine_block subroutine_statement    { $$.node = $1.node; $$.node->add_child( $2.node ); }
                  ;
@@ -154,14 +158,17 @@ statement : %empty                                          { $$.node = nullptr;
           | dim_stmt T_END_OF_STATEMENT                     { $$.node = $1.node; }
           | assign_stmt T_END_OF_STATEMENT                  { $$.node = $1.node; }
           | poke_stmt T_END_OF_STATEMENT                    { $$.node = $1.node; }
+          | block_stmt T_END_OF_STATEMENT                   { $$.node = $1.node; }
           | print_stmt T_END_OF_STATEMENT                   { $$.node = $1.node; }
           | sleep_stmt T_END_OF_STATEMENT                   { $$.node = $1.node; }
-          | T_EXIT T_END_OF_STATEMENT                       { $$.node = make_shared<ASTNodeBreak>( @1, T_EXIT ); }
-          | T_BREAK T_END_OF_STATEMENT                      { $$.node = make_shared<ASTNodeBreak>( @1, T_BREAK ); }
-          | T_QUIT T_END_OF_STATEMENT                       { $$.node = make_shared<ASTNodeBreak>( @1, T_QUIT ); }
+          | T_EXIT T_END_OF_STATEMENT                       { $$.node = make_node<ASTNodeBreak>( @1, env, T_EXIT ); }
+          | T_BREAK T_END_OF_STATEMENT                      { $$.node = make_node<ASTNodeBreak>( @1, env, T_BREAK ); }
+          | T_QUIT T_END_OF_STATEMENT                       { $$.node = make_node<ASTNodeBreak>( @1, env, T_QUIT ); }
           | if_block                                        { $$.node = $1.node; }
           | while_block                                     { $$.node = $1.node; }
           | for_block                                       { $$.node = $1.node; }
+          | every_block                                     { $$.node = $1.node; }
+          | guard_block                                     { $$.node = $1.node; }
           | plain_identifier proc_args T_END_OF_STATEMENT   { $$.node = env->get_procedure( @1, $1.value, $2.arglist ); if( !$$.node ) throw ASTExceptionSyntaxError( @1 ); }
           ;
 
@@ -243,13 +250,13 @@ global_stmt : T_GLOBAL plain_identifier T_END_OF_STATEMENT          { if( !env->
             ;
 
 static_stmt : T_STATIC plain_identifier
-              T_ASSIGN expression T_END_OF_STATEMENT            { $$.node = make_shared<ASTNodeStatic>( @1, env, $2.value, $4.node, true ); }
+              T_ASSIGN expression T_END_OF_STATEMENT            { $$.node = make_node<ASTNodeStatic>( @1, env, $2.value, $4.node, true ); }
             | T_STATIC plain_identifier '[' expression ']'
-              T_END_OF_STATEMENT                                { $$.node = make_shared<ASTNodeStatic>( @1, env, $2.value, $4.node, false ); }
+              T_END_OF_STATEMENT                                { $$.node = make_node<ASTNodeStatic>( @1, env, $2.value, $4.node, false ); }
             | T_STATIC plain_identifier '[' ']'
-              T_ASSIGN '[' comma_list ']' T_END_OF_STATEMENT    { $$.node = make_shared<ASTNodeStatic>( @1, env, $2.value ); for( auto arg: $7.arglist ) $$.node->add_child( arg.first ); }
+              T_ASSIGN '[' comma_list ']' T_END_OF_STATEMENT    { $$.node = make_node<ASTNodeStatic>( @1, env, $2.value ); for( auto arg: $7.arglist ) $$.node->add_child( arg.first ); }
             | T_STATIC plain_identifier '[' ']' T_ASSIGN
-              plain_identifier '[' ']'	T_END_OF_STATEMENT      { $$.node = make_shared<ASTNodeStatic>( @1, env, $2.value, $6.value ); }
+              plain_identifier '[' ']'	T_END_OF_STATEMENT      { $$.node = make_node<ASTNodeStatic>( @1, env, $2.value, $6.value ); }
             ;
 
 drop_stmt : T_DROP plain_identifier                     { if( !env->drop_procedure( $2.value ) ) throw ASTExceptionNamingConflict( @1, $2.value ); }
@@ -261,10 +268,10 @@ drop_stmt : T_DROP plain_identifier                     { if( !env->drop_procedu
  * control flow structures
  ****************************************************************************/
 
-if_block : if_def statement                                             { $$.node = make_shared<ASTNodeIf>( @$, $1.node, $2.node ); }
-         | if_def statement else_def                                    { $$.node = make_shared<ASTNodeIf>( @$, $1.node, $2.node, $3.node ); }
-         | if_def T_END_OF_STATEMENT block T_ENDIF T_END_OF_STATEMENT   { $$.node = make_shared<ASTNodeIf>( @$, $1.node, $3.node ); }
-         | if_def T_END_OF_STATEMENT block else_def                     { $$.node = make_shared<ASTNodeIf>( @$, $1.node, $3.node, $4.node ); }
+if_block : if_def statement                                             { $$.node = make_node<ASTNodeIf>( @$, $1.node, $2.node ); }
+         | if_def statement else_def                                    { $$.node = make_node<ASTNodeIf>( @$, $1.node, $2.node, $3.node ); }
+         | if_def T_END_OF_STATEMENT block T_ENDIF T_END_OF_STATEMENT   { $$.node = make_node<ASTNodeIf>( @$, $1.node, $3.node ); }
+         | if_def T_END_OF_STATEMENT block else_def                     { $$.node = make_node<ASTNodeIf>( @$, $1.node, $3.node, $4.node ); }
          ;
 
 if_def : T_IF expression T_THEN                                         { $$.node = $2.node; }
@@ -274,10 +281,10 @@ else_def : T_ELSE statement                                             { $$.nod
          | T_ELSE T_END_OF_STATEMENT block T_ENDIF T_END_OF_STATEMENT   { $$.node = $3.node; }
          ;
 
-while_block : T_WHILE expression T_DO statement         { $$.node = make_shared<ASTNodeWhile>( @$, $2.node, $4.node ); }
+while_block : T_WHILE expression T_DO statement         { $$.node = make_node<ASTNodeWhile>( @$, env, $2.node, $4.node ); }
             | T_WHILE expression T_DO T_END_OF_STATEMENT
                   block
-              T_ENDWHILE T_END_OF_STATEMENT             { $$.node = make_shared<ASTNodeWhile>( @$, $2.node, $5.node ); }
+              T_ENDWHILE T_END_OF_STATEMENT             { $$.node = make_node<ASTNodeWhile>( @$, env, $2.node, $5.node ); }
             ;
 
 for_block : for_def statement                           { $$.node = $1.node; $$.node->add_child( $2.node ); }
@@ -286,37 +293,57 @@ for_block : for_def statement                           { $$.node = $1.node; $$.
             T_ENDFOR T_END_OF_STATEMENT                 { $$.node = $1.node; $$.node->add_child( $3.node ); }
           ;
 
-for_def : T_FOR plain_identifier T_FROM expression T_TO expression T_DO                     { $$.node = make_shared<ASTNodeFor>( @$, make_shared<ASTNodeAssign>( @2, env, $2.value, $4.node ), $6.node ); }
-        | T_FOR plain_identifier T_FROM expression T_TO expression T_STEP expression T_DO   { $$.node = make_shared<ASTNodeFor>( @$, make_shared<ASTNodeAssign>( @2, env, $2.value, $4.node ), $6.node, $8.node ); }
+for_def : T_FOR plain_identifier T_FROM expression T_TO expression T_DO                     { $$.node = make_node<ASTNodeFor>( @$, env, make_node<ASTNodeAssign>( @2, env, $2.value, $4.node ), $6.node ); }
+        | T_FOR plain_identifier T_FROM expression T_TO expression T_STEP expression T_DO   { $$.node = make_node<ASTNodeFor>( @$, env, make_node<ASTNodeAssign>( @2, env, $2.value, $4.node ), $6.node, $8.node ); }
         ;
 
+every_block : every_def statement                       { $$.node = $1.node; $$.node->add_child( $2.node ); }
+            | every_def T_END_OF_STATEMENT
+                  block
+              T_ENDEVERY T_END_OF_STATEMENT             { $$.node = $1.node; $$.node->add_child( $3.node ); }
+            ;
+
+every_def : T_EVERY expression every_policy T_DO                                { $$.node = make_node<ASTNodeEvery>( @$, env, $2.node, $3.token ); }
+          | T_EVERY expression every_policy plain_identifier '[' ']' T_DO       { $$.node = make_node<ASTNodeEvery>( @$, env, $2.node, $3.token, $4.value ); }
+          ;
+
+every_policy : %empty                                   { $$.token = ASTNodeEvery::POLICY_SKIP; }
+             | T_CATCHUP                                { $$.token = ASTNodeEvery::POLICY_CATCH_UP; }
+             ;
+
+guard_block : T_GUARD T_END_OF_STATEMENT
+                  block
+              T_ENDGUARD T_END_OF_STATEMENT             { $$.node = make_node<ASTNodeGuard>( @$, $3.node ); }
+            ;
+
 
 /*****************************************************************************
  * variables and arrays
  ****************************************************************************/
 
-assign_stmt : plain_identifier T_ASSIGN expression          { $$.node = make_shared<ASTNodeAssign>( @$, env, $1.value, $3.node ); }
+assign_stmt : plain_identifier T_ASSIGN expression          { $$.node = make_node<ASTNodeAssign>( @$, env, $1.value, $3.node ); }
             | plain_identifier '[' expression ']'
-              T_ASSIGN expression                           { $$.node = make_shared<ASTNodeAssign>( @$, env, $1.value, $3.node, $6.node ); }
-            | plain_identifier '[' ']' T_ASSIGN T_SCONST    { $$.node = make_shared<ASTNodeString>( @$, env, $1.value, $5.value.substr( 1, $5.value.length() - 2 ) ); }
+              T_ASSIGN expression                           { $$.node = make_node<ASTNodeAssign>( @$, env, $1.value, $3.node, $6.node ); }
+            | plain_identifier '[' ']' T_ASSIGN T_SCONST    { $$.node = make_node<ASTNodeString>( @$, env, $1.value, $5.value.substr( 1, $5.value.length() - 2 ) ); }
             | plain_identifier '[' ']'
-              T_ASSIGN plain_identifier '[' ']'             { $$.node = make_shared<ASTNodeAssign>( @$, env, $1.value, $5.value ); }
+              T_ASSIGN plain_identifier '[' ']'             { $$.node = make_node<ASTNodeAssign>( @$, env, $1.value, $5.value ); }
             | plain_identifier '[' ']'
-              T_ASSIGN '[' comma_list ']'                   { $$.node = make_shared<ASTNodeAssign>( @$, env, $1.value ); for( auto arg: $6.arglist ) $$.node->add_child( arg.first ); }
+              T_ASSIGN '[' comma_list ']'                   { $$.node = make_node<ASTNodeAssign>( @$, env, $1.value ); for( auto arg: $6.arglist ) $$.node->add_child( arg.first ); }
             | plain_identifier '[' ']'
-              T_ASSIGN T_ARGS '{' expression '}' '[' ']'    { $$.node = make_shared<ASTNodeAssignArg>( @$, env, $1.value, $7.node ); }
+              T_ASSIGN T_ARGS '{' expression '}' '[' ']'    { $$.node = make_node<ASTNodeAssignArg>( @$, env, $1.value, $7.node ); }
             | plain_identifier '[' ']'
               T_ASSIGN plain_identifier '(' func_args ')'   { $$.node = env->get_arrayfunc( @1, $5.value, $1.value, $7.arglist ); if( !$$.node ) throw ASTExceptionSyntaxError( @1 ); }
             ;
 
-def_stmt : T_DEF plain_identifier expression                                    { $$.node = make_shared<ASTNodeDef>( @$, env, $2.value, $3.node ); }
-         | T_DEF struct_identifier expression                                   { $$.node = make_shared<ASTNodeDef>( @$, env, $2.value, $3.node ); }
-         | T_DEF struct_identifier '{' expression '}' expression                { $$.node = make_shared<ASTNodeDef>( @$, env, $2.value, $4.node, $6.node, env->get_default_size() ); }
-         | T_DEF struct_identifier size_suffix '{' expression '}' expression    { $$.node = make_shared<ASTNodeDef>( @$, env, $2.value, $5.node, $7.node, $3.token ); }
-         | T_DEF plain_identifier expression T_FROM plain_identifier            { $$.node = make_shared<ASTNodeDef>( @$, env, $2.value, $3.node, $5.value ); }
+def_stmt : T_DEF plain_identifier expression                                    { $$.node = make_node<ASTNodeDef>( @$, env, $2.value, $3.node ); }
+         | T_DEF struct_identifier expression                                   { $$.node = make_node<ASTNodeDef>( @$, env, $2.value, $3.node ); }
+         | T_DEF struct_identifier '{' expression '}' expression                { $$.node = make_node<ASTNodeDef>( @$, env, $2.value, $4.node, $6.node, env->get_default_size() ); }
+         | T_DEF struct_identifier size_suffix '{' expression '}' expression    { $$.node = make_node<ASTNodeDef>( @$, env, $2.value, $5.node, $7.node, $3.token ); }
+         | T_DEF plain_identifier expression T_FROM plain_identifier            { $$.node = make_node<ASTNodeDef>( @$, env, $2.value, $3.node, $5.value ); }
          ;
 
-dim_stmt : T_DIM plain_identifier '[' expression ']'    { $$.node = make_shared<ASTNodeDim>( @$, env, $2.value, $4.node ); }
+dim_stmt : T_DIM plain_identifier '[' expression ']'                 { $$.node = make_node<ASTNodeDim>( @$, env, $2.value, $4.node ); }
+         | T_DIM size_suffix plain_identifier '[' expression ']'     { $$.node = make_node<ASTNodeDim>( @$, env, $3.value, $5.node, $2.token ); }
          ;
 
 comma_list : %empty                                     { $$.arglist.clear(); }
@@ -329,11 +356,11 @@ comma_list : %empty                                     { $$.arglist.clear(); }
  * special functions
  ****************************************************************************/
 
-map_stmt : T_MAP expression expression                  { $$.node = make_shared<ASTNodeMap>( @$, env, $2.node, $3.node ); }
-         | T_MAP expression expression T_AT expression  { $$.node = make_shared<ASTNodeMap>( @$, env, $2.node, $5.node, $3.node ); }
-         | T_MAP expression expression T_SCONST         { $$.node = make_shared<ASTNodeMap>( @$, env, $2.node, $3.node, $4.value.substr( 1, $4.value.length() - 2 ) ); }
+map_stmt : T_MAP expression expression                  { $$.node = make_node<ASTNodeMap>( @$, env, $2.node, $3.node ); }
+         | T_MAP expression expression T_AT expression  { $$.node = make_node<ASTNodeMap>( @$, env, $2.node, $5.node, $3.node ); }
+         | T_MAP expression expression T_SCONST         { $$.node = make_node<ASTNodeMap>( @$, env, $2.node, $3.node, $4.value.substr( 1, $4.value.length() - 2 ) ); }
          | T_MAP expression expression T_SCONST
-           T_AT expression                              { $$.node = make_shared<ASTNodeMap>( @$, env, $2.node, $6.node, $3.node, $4.value.substr( 1, $4.value.length() - 2 ) ); }
+           T_AT expression                              { $$.node = make_node<ASTNodeMap>( @$, env, $2.node, $6.node, $3.node, $4.value.substr( 1, $4.value.length() - 2 ) ); }
          ;
 
 pragma_stmt : T_PRAGMA T_PRINT print_array              { env->set_default_modifier( $3.token ); }
@@ -342,20 +369,41 @@ pragma_stmt : T_PRAGMA T_PRINT print_array              { env->set_default_modif
             | T_PRAGMA T_PRINT print_format print_size  { env->set_default_modifier( $3.token | $4.token ); }
             | T_PRAGMA T_WORDSIZE T_CONSTANT            { if( !env->set_default_size( env->parse_int( $3.value ) ) ) throw ASTExceptionSyntaxError( @3 ); }
             | T_PRAGMA T_LOADPATH T_SCONST              { string path = $3.value.substr( 1, $3.value.length() - 2 ); if( !env->add_include_path( path ) ) throw ASTExceptionFileNotFound( @3, path.c_str() ); }
+            | T_PRAGMA T_MEMOIZE plain_identifier '(' ')'   { if( !env->memoize_function( @3, $3.value ) ) throw ASTExceptionNamingConflict( @3, $3.value ); }
             ;
 
-import_stmt : T_IMPORT T_SCONST                         { $$.node = make_shared<ASTNodeImport>( @$, env, $2.value.substr( 1, $2.value.length() - 2 ), true ); }
-            | T_RUN T_SCONST                            { $$.node = make_shared<ASTNodeImport>( @$, env, $2.value.substr( 1, $2.value.length() - 2 ), false ); }
+import_stmt : T_IMPORT T_SCONST                         { $$.node = make_node<ASTNodeImport>( @$, env, $2.value.substr( 1, $2.value.length() - 2 ), true ); }
+            | T_RUN T_SCONST                            { $$.node = make_node<ASTNodeImport>( @$, env, $2.value.substr( 1, $2.value.length() - 2 ), false ); }
             ;
 
-poke_stmt : poke_token expression expression                        { $$.node = make_shared<ASTNodePoke>( @$, env, $2.node, $3.node, $1.token ); }
-          | poke_token expression expression T_MASK expression      { $$.node = make_shared<ASTNodePoke>( @$, env, $2.node, $3.node, $5.node, $1.token ); }
+poke_stmt : poke_token expression expression                        { $$.node = make_node<ASTNodePoke>( @$, env, $2.node, $3.node, $1.token ); }
+          | poke_token expression expression T_MASK expression      { $$.node = make_node<ASTNodePoke>( @$, env, $2.node, $3.node, $5.node, $1.token ); }
           ;
 
 poke_token : T_POKE                                     { $$.token = env->get_default_size(); }
            | T_POKE size_suffix                         { $$.token = $2.token; }
            ;
 
+block_stmt : peekblock_token plain_identifier '[' ']' expression expression     { $$.node = make_node<ASTNodePeekBlock>( @$, env, $2.value, $5.node, $6.node, $1.token ); }
+           | pokeblock_token expression plain_identifier '[' ']' expression     { $$.node = make_node<ASTNodePokeBlock>( @$, env, $2.node, $3.value, $6.node, $1.token ); }
+           | memfind_token plain_identifier '[' ']' expression expression expression
+                                                        { $$.node = make_node<ASTNodeMemFind>( @$, env, $2.value, $5.node, $6.node, $7.node, nullptr, $1.token ); }
+           | memfind_token plain_identifier '[' ']' expression expression expression T_MASK expression
+                                                        { $$.node = make_node<ASTNodeMemFind>( @$, env, $2.value, $5.node, $6.node, $7.node, $9.node, $1.token ); }
+           ;
+
+peekblock_token : T_PEEKBLOCK                           { $$.token = env->get_default_size(); }
+                | T_PEEKBLOCK size_suffix               { $$.token = $2.token; }
+                ;
+
+pokeblock_token : T_POKEBLOCK                           { $$.token = env->get_default_size(); }
+                | T_POKEBLOCK size_suffix               { $$.token = $2.token; }
+                ;
+
+memfind_token : T_MEMFIND                               { $$.token = env->get_default_size(); }
+              | T_MEMFIND size_suffix                   { $$.token = $2.token; }
+              ;
+
 size_suffix : T_8BIT                                    { $$.token = $1.token; }
             | T_16BIT                                   { $$.token = $1.token; }
             | T_32BIT                                   { $$.token = $1.token; }
@@ -366,7 +414,7 @@ print_stmt : print_stmt_endl                            { $$.node = printnode; }
            | print_stmt_endl T_NOENDL                   { $$.node = printnode; printnode->set_endl( false ); }
            ;
 
-print_stmt_endl : T_PRINT                               { printnode = make_shared<ASTNodePrint>( @$, env ); yyarg_start(); }
+print_stmt_endl : T_PRINT                               { printnode = make_node<ASTNodePrint>( @$, env ); yyarg_start(); }
                   print_args                            { yyarg_end(); }
                 ;
 
@@ -377,7 +425,7 @@ print_args : %empty                                         { $$.token = env->ge
            | print_args print_format print_size             { $$.token = ($1.token & ~ASTNodePrint::MOD_TYPESIZEMASK) | $2.token | $3.token; }
            | print_args T_SCONST                            { $$.token = $1.token; printnode->add_arg( $2.value.substr( 1, $2.value.length() - 2 ) ); }
            | print_args plain_identifier '(' func_args ')'  { $$.token = $1.token; printnode->add_arg( yyfuncarg( @2, env, $2.value, $4.arglist ).first, $$.token ); }
-           | print_args plain_identifier '[' ']'            { $$.token = $1.token; printnode->add_arg( make_shared<ASTNodeArray>( yylloc, env, $2.value ), $$.token ); }
+           | print_args plain_identifier '[' ']'            { $$.token = $1.token; printnode->add_arg( make_node<ASTNodeArray>( yylloc, env, $2.value ), $$.token ); }
            | print_args expression                          { $$.token = $1.token; printnode->add_arg( $2.node, $$.token & ~ASTNodePrint::MOD_ARRAYMASK ); }
            ;
 
@@ -399,8 +447,8 @@ print_size : T_8BIT                                     { $$.token = ASTNodePrin
            | T_64BIT                                    { $$.token = ASTNodePrint::MOD_64BIT; }
            ;
 
-sleep_stmt : T_SLEEP expression                         { $$.node = make_shared<ASTNodeSleep>( @$, env, $2.node, false ); }
-           | T_SLEEP T_UNTIL expression                 { $$.node = make_shared<ASTNodeSleep>( @$, env, $3.node, true ); }
+sleep_stmt : T_SLEEP expression                         { $$.node = make_node<ASTNodeSleep>( @$, env, $2.node, false ); }
+           | T_SLEEP T_UNTIL expression                 { $$.node = make_node<ASTNodeSleep>( @$, env, $3.node, true ); }
            ;
 
 
@@ -408,85 +456,89 @@ sleep_stmt : T_SLEEP expression                         { $$.node = make_shared<
  * expressions
  ****************************************************************************/
 
-expression : expression T_LOG_OR and_expr               { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-           | expression T_LOG_XOR and_expr              { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+expression : expression T_LOG_OR and_expr               { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+           | expression T_LOG_XOR and_expr              { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
            | and_expr                                   { $$.node = $1.node; }
            ;
 
-and_expr : and_expr T_LOG_AND comp_expr                 { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+and_expr : and_expr T_LOG_AND comp_expr                 { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
          | comp_expr                                    { $$.node = $1.node; }
          ;
 
-comp_expr : add_expr T_LT add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_GT add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_LE add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_GE add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_EQ add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_NE add_expr                      { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_SLT add_expr                     { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_SGT add_expr                     { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_SLE add_expr                     { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-          | add_expr T_SGE add_expr                     { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+comp_expr : add_expr T_LT add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_GT add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_LE add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_GE add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_EQ add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_NE add_expr                      { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_SLT add_expr                     { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_SGT add_expr                     { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_SLE add_expr                     { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+          | add_expr T_SGE add_expr                     { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
           | add_expr                                    { $$.node = $1.node; }
           ;
 
-add_expr : add_expr T_PLUS mul_expr                     { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | add_expr T_MINUS mul_expr                    { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | add_expr T_BIT_OR mul_expr                   { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | add_expr T_BIT_XOR mul_expr                  { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+add_expr : add_expr T_PLUS mul_expr                     { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | add_expr T_MINUS mul_expr                    { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | add_expr T_BIT_OR mul_expr                   { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | add_expr T_BIT_XOR mul_expr                  { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
          | mul_expr                                     { $$.node = $1.node; }
          ;
 
-mul_expr : mul_expr T_MUL shift_expr                    { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | mul_expr T_DIV shift_expr                    { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | mul_expr T_MOD shift_expr                    { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | mul_expr T_SDIV shift_expr                   { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | mul_expr T_SMOD shift_expr                   { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-         | mul_expr T_BIT_AND shift_expr                { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+mul_expr : mul_expr T_MUL shift_expr                    { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | mul_expr T_DIV shift_expr                    { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | mul_expr T_MOD shift_expr                    { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | mul_expr T_SDIV shift_expr                   { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | mul_expr T_SMOD shift_expr                   { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+         | mul_expr T_BIT_AND shift_expr                { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
          | shift_expr                                   { $$.node = $1.node; }
          ;
 
-shift_expr : shift_expr T_LSHIFT unary_expr             { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
-           | shift_expr T_RSHIFT unary_expr             { $$.node = make_shared<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+shift_expr : shift_expr T_LSHIFT unary_expr             { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
+           | shift_expr T_RSHIFT unary_expr             { $$.node = make_node<ASTNodeBinaryOperator>( @$, $1.node, $3.node, $2.token ); }
            | unary_expr                                 { $$.node = $1.node; }
            ;
 
-unary_expr : T_MINUS atomic_expr                        { $$.node = make_shared<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
-           | T_BIT_NOT atomic_expr                      { $$.node = make_shared<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
-           | T_LOG_NOT atomic_expr                      { $$.node = make_shared<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
+unary_expr : T_MINUS atomic_expr                        { $$.node = make_node<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
+           | T_BIT_NOT atomic_expr                      { $$.node = make_node<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
+           | T_LOG_NOT atomic_expr                      { $$.node = make_node<ASTNodeUnaryOperator>( @$, $2.node, $1.token ); }
            | atomic_expr                                { $$.node = $1.node; }
            ;
 
-atomic_expr : T_CONSTANT                                { $$.node = make_shared<ASTNodeConstant>( @$, $1.value ); }
-            | T_FCONST                                  { $$.node = make_shared<ASTNodeConstant>( @$, $1.value, true ); }
-            | T_NOW                                     { $$.node = make_shared<ASTNodeSleep>( @$, env ); }
+atomic_expr : T_CONSTANT                                { $$.node = make_node<ASTNodeConstant>( @$, $1.value ); }
+            | T_FCONST                                  { $$.node = make_node<ASTNodeConstant>( @$, $1.value, true ); }
+            | T_NOW                                     { $$.node = make_node<ASTNodeSleep>( @$, env ); }
             | var_identifier                            { $$.node = $1.node; }
             | '(' expression ')'                        { $$.node = $2.node; }
             | args_expr                                 { $$.node = $1.node; }
-            | peek_token '(' expression ')'             { $$.node = make_shared<ASTNodePeek>( @$, env, $3.node, $1.token ); }
+            | peek_token '(' expression ')'             { $$.node = make_node<ASTNodePeek>( @$, env, $3.node, $1.token ); }
+            | memfind_token '(' expression ',' expression ',' expression ')'
+                                                        { $$.node = make_node<ASTNodeMemFind>( @$, env, $3.node, $5.node, $7.node, nullptr, $1.token ); }
+            | memfind_token '(' expression ',' expression ',' expression ',' expression ')'
+                                                        { $$.node = make_node<ASTNodeMemFind>( @$, env, $3.node, $5.node, $7.node, $9.node, $1.token ); }
             | plain_identifier '(' func_args ')'        { $$.node = env->get_function( @1, $1.value, $3.arglist ); if( !$$.node ) throw ASTExceptionSyntaxError( @1 ); }
             ;
 
-args_expr : T_ARGS '{' '?' '}'                              { $$.node = make_shared<ASTNodeArg>( @$, env ); }
-          | T_ARGS '{' expression '}' '[' ']' '?'           { $$.node = make_shared<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_TYPE ); }
-          | T_ARGS '{' expression '}'                       { $$.node = make_shared<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_VAR ); }
-          | T_ARGS '{' expression '}' '[' '?' ']'           { $$.node = make_shared<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_ARRAYSIZE ); }
-          | T_ARGS '{' expression '}' '[' expression ']'    { $$.node = make_shared<ASTNodeArg>( @$, env, $3.node, $6.node ); }
+args_expr : T_ARGS '{' '?' '}'                              { $$.node = make_node<ASTNodeArg>( @$, env ); }
+          | T_ARGS '{' expression '}' '[' ']' '?'           { $$.node = make_node<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_TYPE ); }
+          | T_ARGS '{' expression '}'                       { $$.node = make_node<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_VAR ); }
+          | T_ARGS '{' expression '}' '[' '?' ']'           { $$.node = make_node<ASTNodeArg>( @$, env, $3.node, ASTNodeArg::GET_ARRAYSIZE ); }
+          | T_ARGS '{' expression '}' '[' expression ']'    { $$.node = make_node<ASTNodeArg>( @$, env, $3.node, $6.node ); }
           ;
 
 peek_token : T_PEEK                                     { $$.token = env->get_default_size(); }
            | T_PEEK size_suffix                         { $$.token = $2.token; }
            ;
 
-var_identifier : plain_identifier                       { $$.node = make_shared<ASTNodeVar>( @$, env, $1.value ); }
-               | struct_identifier                      { $$.node = make_shared<ASTNodeVar>( @$, env, $1.value ); }
-               | struct_identifier '{' '?' '}'          { $$.node = make_shared<ASTNodeRange>( @$, env, $1.value ); }
-               | struct_identifier '{' expression '}'   { $$.node = make_shared<ASTNodeRange>( @$, env, $1.value, $3.node ); }
+var_identifier : plain_identifier                       { $$.node = make_node<ASTNodeVar>( @$, env, $1.value ); }
+               | struct_identifier                      { $$.node = make_node<ASTNodeVar>( @$, env, $1.value ); }
+               | struct_identifier '{' '?' '}'          { $$.node = make_node<ASTNodeRange>( @$, env, $1.value ); }
+               | struct_identifier '{' expression '}'   { $$.node = make_node<ASTNodeRange>( @$, env, $1.value, $3.node ); }
                | array_identifier                       { $$.node = $1.node; }
                ;
 
-array_identifier : plain_identifier '[' '?' ']'         { $$.node = make_shared<ASTNodeArray>( @$, env, $1.value ); }
-                 | plain_identifier '[' expression ']'  { $$.node = make_shared<ASTNodeArray>( @$, env, $1.value, $3.node ); }
+array_identifier : plain_identifier '[' '?' ']'         { $$.node = make_node<ASTNodeArray>( @$, env, $1.value ); }
+                 | plain_identifier '[' expression ']'  { $$.node = make_node<ASTNodeArray>( @$, env, $1.value, $3.node ); }
                  ;
 
 struct_identifier : T_IDENTIFIER '.' T_IDENTIFIER       { $$.value = $1.value + '.' + $3.value; }
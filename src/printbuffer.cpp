@@ -0,0 +1,125 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "printbuffer.h"
+
+#include <stdio.h>
+
+using namespace std;
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class PrintBuffer implementation
+//////////////////////////////////////////////////////////////////////////////
+
+PrintBuffer::PrintBuffer( std::ostream& out )
+ : m_Stream( &out )
+{
+    m_Buffer.reserve( FLUSH_THRESHOLD + 1024 );
+}
+
+PrintBuffer::~PrintBuffer()
+{
+    flush();
+}
+
+void PrintBuffer::set_stream( std::ostream& out )
+{
+    flush();
+    m_Stream = &out;
+}
+
+void PrintBuffer::put_hex( uint64_t value, int digits )
+{
+    static const char hexdigits[] = "0123456789abcdef";
+
+    char buf[16];
+    int len = 0;
+
+    do {
+        buf[ 15 - len++ ] = hexdigits[ value & 0xf ];
+        value >>= 4;
+    } while( value );
+
+    m_Buffer.append( "0x" );
+    if( digits > len ) m_Buffer.append( digits - len, '0' );
+    m_Buffer.append( buf + 16 - len, len );
+
+    check_flush();
+}
+
+void PrintBuffer::put_dec( uint64_t value )
+{
+    char buf[20];
+    int len = 0;
+
+    do {
+        buf[ 19 - len++ ] = '0' + value % 10;
+        value /= 10;
+    } while( value );
+
+    m_Buffer.append( buf + 20 - len, len );
+
+    check_flush();
+}
+
+void PrintBuffer::put_signed( int64_t value )
+{
+    if( value < 0 ) {
+        m_Buffer.push_back( '-' );
+        put_dec( 0 - (uint64_t)value );
+    }
+    else put_dec( value );
+}
+
+void PrintBuffer::put_bin( uint64_t value, int bits )
+{
+    for( int i = bits - 1; i >= 0; i-- ) {
+        m_Buffer.push_back( (value & ((uint64_t)1 << i)) ? '1' : '0' );
+        if( i > 0 && i % 4 == 0 ) m_Buffer.push_back( ' ' );
+    }
+
+    check_flush();
+}
+
+void PrintBuffer::put_float( double value )
+{
+    // same format as the default formatting of std::ostream
+    char buf[32];
+    int len = snprintf( buf, sizeof(buf), "%g", value );
+    if( len > 0 ) m_Buffer.append( buf, len );
+
+    check_flush();
+}
+
+void PrintBuffer::flush()
+{
+    if( !m_Buffer.empty() ) {
+        m_Stream->write( m_Buffer.data(), m_Buffer.length() );
+        m_Buffer.clear();
+    }
+
+    m_Stream->flush();
+}
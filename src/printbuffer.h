@@ -0,0 +1,126 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __printbuffer_h__
+#define __printbuffer_h__
+
+#include <string>
+#include <ostream>
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class PrintBuffer
+//////////////////////////////////////////////////////////////////////////////
+
+// collects the output of the print command and writes it to the stream in
+// large chunks. The buffer is flushed when it is full, at the end of each
+// line in line buffered mode and explicitly before the program waits.
+class PrintBuffer {
+public:
+    PrintBuffer( std::ostream& out );
+    ~PrintBuffer();
+
+    void set_stream( std::ostream& out );
+
+    void set_line_buffered( bool enable );
+    bool is_line_buffered() const;
+
+    void put( char c );
+    void write( const char* str, size_t len );
+    void write( const std::string& str );
+
+    void put_hex( uint64_t value, int digits );
+    void put_dec( uint64_t value );
+    void put_signed( int64_t value );
+    void put_bin( uint64_t value, int bits );
+    void put_float( double value );
+
+    void end_line();
+
+    void flush();
+
+private:
+    static const size_t FLUSH_THRESHOLD = 64 * 1024;
+
+    void check_flush();
+
+    std::ostream* m_Stream;
+
+    std::string m_Buffer;
+
+    bool m_IsLineBuffered = false;
+
+    PrintBuffer( const PrintBuffer& ) = delete;
+    PrintBuffer& operator=( const PrintBuffer& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class PrintBuffer inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline void PrintBuffer::set_line_buffered( bool enable )
+{
+    m_IsLineBuffered = enable;
+}
+
+inline bool PrintBuffer::is_line_buffered() const
+{
+    return m_IsLineBuffered;
+}
+
+inline void PrintBuffer::put( char c )
+{
+    m_Buffer.push_back( c );
+}
+
+inline void PrintBuffer::write( const char* str, size_t len )
+{
+    m_Buffer.append( str, len );
+    check_flush();
+}
+
+inline void PrintBuffer::write( const std::string& str )
+{
+    write( str.data(), str.length() );
+}
+
+inline void PrintBuffer::end_line()
+{
+    m_Buffer.push_back( '\n' );
+    if( m_IsLineBuffered ) flush();
+    else check_flush();
+}
+
+inline void PrintBuffer::check_flush()
+{
+    if( m_Buffer.length() >= FLUSH_THRESHOLD ) flush();
+}
+
+
+#endif // __printbuffer_h__
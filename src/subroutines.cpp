@@ -56,29 +56,32 @@ SubroutineManager::~SubroutineManager()
     }
 }
 
-void SubroutineManager::begin_subroutine( const yylloc_t& location, std::string name, bool is_function )
+void SubroutineManager::begin_subroutine( const yylloc_t& location, symbol_t name, bool is_function )
 {
     assert( m_PendingSubroutine == nullptr );
 
-    if( m_Subroutines.find( name ) != m_Subroutines.end() ) throw ASTExceptionNamingConflict( location, name );
+    if( m_Subroutines.find( name ) != m_Subroutines.end() ) throw ASTExceptionNamingConflict( location, SymbolTable::get_name( name ) );
 
     m_PendingName = name;
     m_PendingSubroutine = new subroutine_t;
     m_PendingSubroutine->vars = new VarManager;
     m_PendingSubroutine->arrays = new ArrayManager;
     m_PendingSubroutine->location = location;
+    m_PendingSubroutine->memo = make_shared< memo_t >();
     m_PendingSubroutine->has_varargs = false;
 
     if( is_function ) {
-        m_PendingSubroutine->retval =  m_PendingSubroutine->vars->alloc_local( "return" );
+        m_PendingSubroutine->retval =  m_PendingSubroutine->vars->alloc_local( SymbolTable::intern( "return" ) );
         assert( m_PendingSubroutine->retval );
     }
 }
 
-void SubroutineManager::set_param( std::string name, bool is_array )
+void SubroutineManager::set_param( symbol_t symbol, bool is_array )
 {
     assert( m_PendingSubroutine );
 
+    const string& name = SymbolTable::get_name( symbol );
+
     if( is_array ) {
         Environment::refarray* array = m_Environment->alloc_ref_array( name );
         if( !array ) throw ASTExceptionNamingConflict( m_PendingSubroutine->location, name );
@@ -133,7 +136,7 @@ void SubroutineManager::abort_subroutine()
     m_PendingSubroutine = nullptr;
 }
 
-bool SubroutineManager::drop_subroutine( std::string name )
+bool SubroutineManager::drop_subroutine( symbol_t name )
 {
     auto iter = m_Subroutines.find( name );
     if( iter == m_Subroutines.end() ) return false;
@@ -146,15 +149,33 @@ bool SubroutineManager::drop_subroutine( std::string name )
     return true;
 }
 
-void SubroutineManager::get_autocompletion( std::set< std::string >& completions, std::string prefix )
+bool SubroutineManager::memoize_subroutine( const yylloc_t& location, symbol_t name )
+{
+    auto iter = m_Subroutines.find( name );
+    if( iter == m_Subroutines.end() ) return false;
+
+    subroutine_t* subroutine = iter->second;
+
+    // the cache is keyed by the arguments only, so the result must not depend on anything else
+    bool is_pure = !subroutine->has_varargs && subroutine->body->is_pure();
+    for( auto& param: subroutine->params ) is_pure &= !param.is_array;
+
+    if( !is_pure ) throw ASTExceptionImpureFunction( location, SymbolTable::get_name( name ) );
+
+    subroutine->memo->is_enabled = true;
+
+    return true;
+}
+
+void SubroutineManager::get_autocompletion( std::set< std::string >& completions, const std::string& prefix )
 {
-    for( auto iter = m_Subroutines.lower_bound( prefix ); iter != m_Subroutines.end(); iter++ ) {
-        if( iter->first.substr( 0, prefix.length() ) != prefix ) break;
-        completions.insert( iter->first );
+    for( auto value: m_Subroutines ) {
+        const string& name = SymbolTable::get_name( value.first );
+        if( name.compare( 0, prefix.length(), prefix ) == 0 ) completions.insert( name );
     }
 }
 
-std::shared_ptr<ASTNode> SubroutineManager::get_subroutine( const yylloc_t& location, std::string name, const arglist_t& args )
+std::shared_ptr<ASTNode> SubroutineManager::get_subroutine( const yylloc_t& location, symbol_t name, const arglist_t& args )
 {
     subroutine_t* subroutine;
 
@@ -175,9 +196,10 @@ std::shared_ptr<ASTNode> SubroutineManager::get_subroutine( const yylloc_t& loca
     const size_t num_params = subroutine->params.size();
     const size_t num_varargs = args.size() - num_params;
 
-    ASTNodeSubroutine::ptr node = make_shared<ASTNodeSubroutine>( location, subroutine->body,
+    ASTNodeSubroutine::ptr node = make_node<ASTNodeSubroutine>( location, subroutine->body,
                                                                   m_Environment, subroutine->vars, subroutine->arrays,
-                                                                  subroutine->params, num_varargs, subroutine->retval );
+                                                                  subroutine->params, num_varargs, subroutine->retval,
+                                                                  subroutine->memo );
 
     for( size_t i = 0; i < num_params; i++ ) {
         if( args[i].second.empty() ) {
@@ -187,15 +209,18 @@ std::shared_ptr<ASTNode> SubroutineManager::get_subroutine( const yylloc_t& loca
         else {
             if( !subroutine->params[i].is_array ) throw ASTExceptionSyntaxError( location );
             if( args[i].first ) node->add_child( args[i].first );
-            else node->add_child( make_shared<ASTNodeArray>( location, m_Environment, args[i].second ) );
+            else node->add_child( make_node<ASTNodeArray>( location, m_Environment, args[i].second ) );
         }
     }
 
     for( size_t j = 0; j < num_varargs; j++ ) {
         const size_t i = j + num_params;
         if( args[i].first ) node->add_child( args[i].first );
-        else node->add_child( make_shared<ASTNodeArray>( location, m_Environment, args[i].second ) );
+        else node->add_child( make_node<ASTNodeArray>( location, m_Environment, args[i].second ) );
     }
 
+    // the body of a subroutine is not analyzed before it is complete
+    if( subroutine != m_PendingSubroutine ) node->fold_pure_call();
+
     return node;
 }
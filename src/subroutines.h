@@ -29,9 +29,11 @@
 #include "mempeek_parser.h"
 #include "variables.h"
 #include "arrays.h"
+#include "symbols.h"
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <vector>
 #include <memory>
@@ -48,22 +50,23 @@ public:
     SubroutineManager( Environment* env );
     ~SubroutineManager();
 
-    void begin_subroutine( const yylloc_t& location, std::string name, bool is_function );
-    void set_param( std::string name, bool is_array );
+    void begin_subroutine( const yylloc_t& location, symbol_t name, bool is_function );
+    void set_param( symbol_t name, bool is_array );
     void set_body( std::shared_ptr<ASTNode> body );
     void set_varargs();
     void commit_subroutine();
     void abort_subroutine();
 
-    bool drop_subroutine( std::string name );
+    bool drop_subroutine( symbol_t name );
+    bool memoize_subroutine( const yylloc_t& location, symbol_t name );
 
     VarManager* get_var_manager();
     ArrayManager* get_array_manager();
 
-    void get_autocompletion( std::set< std::string >& completions, std::string prefix );
+    void get_autocompletion( std::set< std::string >& completions, const std::string& prefix );
 
-    bool has_subroutine( std::string name );
-    std::shared_ptr<ASTNode> get_subroutine( const yylloc_t& location, std::string name, const arglist_t& args );
+    bool has_subroutine( symbol_t name );
+    std::shared_ptr<ASTNode> get_subroutine( const yylloc_t& location, symbol_t name, const arglist_t& args );
 
     typedef struct {
         bool is_array;
@@ -73,6 +76,14 @@ public:
         } param;
     } param_t;
 
+    // results of a memoized function, shared by all calls of the function
+    typedef struct {
+        bool is_enabled = false;
+        std::map< std::vector< uint64_t >, uint64_t > results;
+    } memo_t;
+
+    static const size_t MAX_MEMO_SIZE = 65536;
+
 
 private:
     typedef struct {
@@ -81,15 +92,16 @@ private:
         std::vector< param_t > params;
         std::shared_ptr<ASTNode> body;
         VarManager::var* retval = nullptr;
+        std::shared_ptr< memo_t > memo;
         bool has_varargs;
         yylloc_t location;
     } subroutine_t;
 
     Environment* m_Environment;
 
-    std::map< std::string, subroutine_t* > m_Subroutines;
+    std::unordered_map< symbol_t, subroutine_t* > m_Subroutines;
 
-    std::string m_PendingName;
+    symbol_t m_PendingName = 0;
     subroutine_t* m_PendingSubroutine = nullptr;
 };
 
@@ -98,7 +110,7 @@ private:
 // class SubroutineManager inline functions
 //////////////////////////////////////////////////////////////////////////////
 
-inline bool SubroutineManager::has_subroutine( std::string name )
+inline bool SubroutineManager::has_subroutine( symbol_t name )
 {
     auto iter = m_Subroutines.find( name );
     return iter != m_Subroutines.end();
@@ -0,0 +1,74 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __symbols_h__
+#define __symbols_h__
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <stdint.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class SymbolTable
+//////////////////////////////////////////////////////////////////////////////
+
+typedef uint32_t symbol_t;
+
+// interned names of vars, arrays and subroutines. The managers key their
+// tables by symbol, so a name is hashed once per lookup in the environment
+// instead of being compared in every manager. Symbols are never removed.
+class SymbolTable {
+public:
+    static symbol_t intern( const std::string& name );
+    static const std::string& get_name( symbol_t symbol );
+
+private:
+    static SymbolTable& get_instance();
+
+    std::unordered_map< std::string, symbol_t > m_Symbols;
+    std::vector< const std::string* > m_Names;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class SymbolTable inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline const std::string& SymbolTable::get_name( symbol_t symbol )
+{
+    return *get_instance().m_Names[ symbol ];
+}
+
+inline SymbolTable& SymbolTable::get_instance()
+{
+    static SymbolTable table;
+    return table;
+}
+
+
+#endif // __symbols_h__
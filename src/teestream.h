@@ -35,10 +35,14 @@
 // class basic_teebuf
 //////////////////////////////////////////////////////////////////////////////
 
+// output is collected in a buffer and forwarded to all attached buffers when
+// the buffer is full or the stream is flushed
 template< typename CharT, typename Traits = std::char_traits< CharT > >
 class basic_teebuf : public std::basic_streambuf< CharT, Traits >
 {
 public:
+    basic_teebuf();
+
     void attach( std::basic_streambuf< CharT, Traits >* buf );
     void detach( std::basic_streambuf< CharT, Traits >* buf );
 
@@ -46,10 +50,18 @@ protected:
     using typename std::basic_streambuf< CharT, Traits >::int_type;
 
     int_type overflow( int_type ch ) override;
+    std::streamsize xsputn( const CharT* s, std::streamsize n ) override;
     int sync() override;
 
 private:
+    static const size_t BUFFER_SIZE = 4096;
+
+    bool forward( const CharT* s, std::streamsize n );
+    bool flush_buffer();
+
     std::vector< std::basic_streambuf< CharT, Traits >* > m_AttachedBuffers;
+
+    CharT m_Buffer[ BUFFER_SIZE ];
 };
 
 
@@ -76,15 +88,25 @@ private:
 // class basic_teebuf template functions
 //////////////////////////////////////////////////////////////////////////////
 
+template< typename CharT, typename Traits >
+inline basic_teebuf< CharT, Traits >::basic_teebuf()
+{
+    this->setp( m_Buffer, m_Buffer + BUFFER_SIZE );
+}
+
 template< typename CharT, typename Traits >
 inline void basic_teebuf< CharT, Traits >::attach( std::basic_streambuf< CharT, Traits >* buf )
 {
+    flush_buffer();
+
     m_AttachedBuffers.push_back( buf );
 }
 
 template< typename CharT, typename Traits >
 inline void basic_teebuf< CharT, Traits >::detach( std::basic_streambuf< CharT, Traits >* buf )
 {
+    flush_buffer();
+
     size_t num_buffers = m_AttachedBuffers.size();
 
     for( size_t i = 0; i < num_buffers; ) {
@@ -99,19 +121,36 @@ inline void basic_teebuf< CharT, Traits >::detach( std::basic_streambuf< CharT,
 template< typename CharT, typename Traits >
 inline typename basic_teebuf< CharT, Traits >::int_type basic_teebuf< CharT, Traits >::overflow( int_type ch )
 {
-    int_type ret = Traits::eof() - 1;
+    bool is_ok = flush_buffer();
 
-    for( auto buf: m_AttachedBuffers ) {
-        if( buf->sputc( ch ) == Traits::eof() ) ret = Traits::eof();
+    if( !Traits::eq_int_type( ch, Traits::eof() ) ) {
+        *this->pptr() = Traits::to_char_type( ch );
+        this->pbump( 1 );
     }
 
-    return ret;
+    return is_ok ? Traits::not_eof( ch ) : Traits::eof();
+}
+
+template< typename CharT, typename Traits >
+inline std::streamsize basic_teebuf< CharT, Traits >::xsputn( const CharT* s, std::streamsize n )
+{
+    if( n <= this->epptr() - this->pptr() ) {
+        Traits::copy( this->pptr(), s, n );
+        this->pbump( n );
+        return n;
+    }
+
+    // large blocks bypass the buffer
+    bool is_ok = flush_buffer();
+    is_ok &= forward( s, n );
+
+    return is_ok ? n : 0;
 }
 
 template< typename CharT, typename Traits >
 inline int basic_teebuf< CharT, Traits >::sync()
 {
-    int ret = 0;
+    int ret = flush_buffer() ? 0 : -1;
 
     for( auto buf: m_AttachedBuffers ) {
         if( buf->pubsync() != 0 ) ret = -1;
@@ -120,6 +159,28 @@ inline int basic_teebuf< CharT, Traits >::sync()
     return ret;
 }
 
+template< typename CharT, typename Traits >
+inline bool basic_teebuf< CharT, Traits >::forward( const CharT* s, std::streamsize n )
+{
+    bool is_ok = true;
+
+    for( auto buf: m_AttachedBuffers ) {
+        if( buf->sputn( s, n ) != n ) is_ok = false;
+    }
+
+    return is_ok;
+}
+
+template< typename CharT, typename Traits >
+inline bool basic_teebuf< CharT, Traits >::flush_buffer()
+{
+    bool is_ok = forward( this->pbase(), this->pptr() - this->pbase() );
+
+    this->setp( m_Buffer, m_Buffer + BUFFER_SIZE );
+
+    return is_ok;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 // class basic_teestream template functions
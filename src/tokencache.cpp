@@ -0,0 +1,233 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "tokencache.h"
+
+#include "hash64.h"
+#include "version.h"
+
+#include <sstream>
+#include <iomanip>
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pwd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+using namespace std;
+
+
+// the flex scanner, see YY_DECL in lexer.l
+int yylex_scan( yyvalue_t* yylval, yylloc_t* yylloc, yyscan_t scanner );
+
+// called by the parser, the scanner argument of yyparse() is a TokenStream
+int yylex( yyvalue_t* yylval, yylloc_t* yylloc, yyscan_t scanner )
+{
+    return static_cast< TokenStream* >( scanner )->lex( yylval, yylloc );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class TokenStream implementation
+//////////////////////////////////////////////////////////////////////////////
+
+TokenStream::TokenStream( const char* file )
+ : m_File( file )
+{}
+
+TokenStream::~TokenStream()
+{
+    if( m_Mapping ) munmap( m_Mapping, m_MappingSize );
+}
+
+void TokenStream::set_scanner( yyscan_t scanner )
+{
+    m_Scanner = scanner;
+}
+
+void TokenStream::start_recording()
+{
+    m_IsRecording = true;
+}
+
+bool TokenStream::is_recording() const
+{
+    return m_IsRecording;
+}
+
+int TokenStream::lex( yyvalue_t* yylval, yylloc_t* yylloc )
+{
+    if( m_Tokens ) {
+        if( m_NextToken >= m_NumTokens ) return 0;
+
+        const token_t& token = m_Tokens[ m_NextToken++ ];
+
+        yylval->value.assign( m_Strings + token.offset, token.length );
+        yylval->token = token.token;
+
+        yylloc->file = m_File;
+        yylloc->first_line = yylloc->last_line = token.line;
+
+        return token.token;
+    }
+
+    int token = yylex_scan( yylval, yylloc, m_Scanner );
+
+    // T_END_OF_STATEMENT and the end of the input are both token 0, the
+    // recording is only complete when the parser accepted the input
+    if( m_IsRecording ) {
+        m_RecordedTokens.push_back( { token, yylloc->first_line, (uint32_t)m_RecordedStrings.length(), (uint32_t)yylval->value.length() } );
+        m_RecordedStrings += yylval->value;
+    }
+
+    return token;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class TokenCache implementation
+//////////////////////////////////////////////////////////////////////////////
+
+TokenCache::TokenCache()
+{}
+
+bool TokenCache::load( const std::string& path, uint64_t content, TokenStream& tokens )
+{
+    const string file = get_cache_file( path );
+    if( file.empty() ) return false;
+
+    int fd = open( file.c_str(), O_RDONLY );
+    if( fd < 0 ) return false;
+
+    struct stat buf;
+    if( fstat( fd, &buf ) != 0 || (size_t)buf.st_size < sizeof( header_t ) ) {
+        close( fd );
+        return false;
+    }
+
+    const size_t size = buf.st_size;
+    void* mapping = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+
+    if( mapping == MAP_FAILED ) return false;
+
+    header_t expected;
+    init_header( expected, content );
+
+    const header_t* header = static_cast< const header_t* >( mapping );
+    const TokenStream::token_t* token_table = reinterpret_cast< const TokenStream::token_t* >( header + 1 );
+
+    // stale entries of another build or of an older content are replaced by store()
+    bool is_valid = memcmp( header->magic, expected.magic, sizeof( header->magic ) ) == 0 &&
+                    memcmp( header->build, expected.build, sizeof( header->build ) ) == 0 &&
+                    header->content == expected.content &&
+                    size == sizeof( header_t ) + (uint64_t)header->num_tokens * sizeof( TokenStream::token_t ) + header->strings_size;
+
+    for( uint32_t i = 0; is_valid && i < header->num_tokens; i++ ) {
+        is_valid = (uint64_t)token_table[i].offset + token_table[i].length <= header->strings_size;
+    }
+
+    if( !is_valid ) {
+        munmap( mapping, size );
+        return false;
+    }
+
+    tokens.m_Mapping = mapping;
+    tokens.m_MappingSize = size;
+    tokens.m_Tokens = token_table;
+    tokens.m_NumTokens = header->num_tokens;
+    tokens.m_Strings = reinterpret_cast< const char* >( token_table + header->num_tokens );
+
+    return true;
+}
+
+void TokenCache::store( const std::string& path, uint64_t content, const TokenStream& tokens )
+{
+    const string file = get_cache_file( path );
+    if( file.empty() ) return;
+
+    header_t header;
+    init_header( header, content );
+    header.num_tokens = tokens.m_RecordedTokens.size();
+    header.strings_size = tokens.m_RecordedStrings.length();
+
+    // write to a temporary file first, concurrent instances must never see a partial file
+    const string tmpfile = file + "." + to_string( getpid() );
+
+    FILE* out = fopen( tmpfile.c_str(), "wb" );
+    if( !out ) return;
+
+    bool is_ok = fwrite( &header, sizeof( header ), 1, out ) == 1;
+    if( header.num_tokens ) is_ok &= fwrite( tokens.m_RecordedTokens.data(), sizeof( TokenStream::token_t ), header.num_tokens, out ) == header.num_tokens;
+    if( header.strings_size ) is_ok &= fwrite( tokens.m_RecordedStrings.data(), header.strings_size, 1, out ) == 1;
+    is_ok &= fclose( out ) == 0;
+
+    if( !is_ok || rename( tmpfile.c_str(), file.c_str() ) != 0 ) unlink( tmpfile.c_str() );
+}
+
+void TokenCache::init_header( header_t& header, uint64_t content )
+{
+    memset( &header, 0, sizeof( header ) );
+
+    memcpy( header.magic, "MPTOKEN2", sizeof( header.magic ) );
+    snprintf( header.build, sizeof( header.build ), "%s %s %s", RELEASE_VERSION, BUILD_NO, BUILD_DATE );
+    header.content = content;
+}
+
+std::string TokenCache::get_cache_file( const std::string& path )
+{
+    if( !m_IsInitialized ) {
+        m_IsInitialized = true;
+
+        const char* dir = getenv( "MEMPEEK_CACHE" );
+        if( dir ) m_Directory = dir;
+        else {
+            passwd* pwd = getpwuid( getuid() );
+            if( pwd ) {
+                string cache = pwd->pw_dir;
+                cache += "/.cache";
+                mkdir( cache.c_str(), 0755 );
+                m_Directory = cache + "/mempeek";
+            }
+        }
+
+        if( !m_Directory.empty() ) {
+            mkdir( m_Directory.c_str(), 0755 );
+
+            struct stat buf;
+            if( stat( m_Directory.c_str(), &buf ) != 0 || !S_ISDIR( buf.st_mode ) ) m_Directory.clear();
+        }
+    }
+
+    if( m_Directory.empty() ) return "";
+
+    ostringstream file;
+    file << m_Directory << '/' << hex << setw( 16 ) << setfill( '0' ) << hash64( path.data(), path.length() ) << ".tok";
+    return file.str();
+}
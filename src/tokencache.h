@@ -0,0 +1,120 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __tokencache_h__
+#define __tokencache_h__
+
+#include "mempeek_parser.h"
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class TokenStream
+//////////////////////////////////////////////////////////////////////////////
+
+// source of the tokens for the parser, yylex() gets a TokenStream as scanner
+// argument. The tokens are either read from the flex scanner, optionally
+// recording them for the token cache, or replayed from a token cache file.
+class TokenStream {
+public:
+    TokenStream( const char* file );
+    ~TokenStream();
+
+    void set_scanner( yyscan_t scanner );
+    void start_recording();
+    bool is_recording() const;
+
+    int lex( yyvalue_t* yylval, yylloc_t* yylloc );
+
+private:
+    friend class TokenCache;
+
+    typedef struct {
+        int32_t token;
+        int32_t line;
+        uint32_t offset;
+        uint32_t length;
+    } token_t;
+
+    yyscan_t m_Scanner = nullptr;
+    const char* m_File;
+
+    // replay from a mapped cache file
+    void* m_Mapping = nullptr;
+    size_t m_MappingSize = 0;
+    const token_t* m_Tokens = nullptr;
+    const char* m_Strings = nullptr;
+    size_t m_NumTokens = 0;
+    size_t m_NextToken = 0;
+
+    // recording for the cache
+    bool m_IsRecording = false;
+    std::vector< token_t > m_RecordedTokens;
+    std::string m_RecordedStrings;
+
+    TokenStream( const TokenStream& ) = delete;
+    TokenStream& operator=( const TokenStream& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class TokenCache
+//////////////////////////////////////////////////////////////////////////////
+
+// on-disk cache of the token streams of script files in $MEMPEEK_CACHE or
+// ~/.cache/mempeek, an empty MEMPEEK_CACHE disables the cache. There is one
+// cache file per script path, it is only used if the content hash and the
+// build of mempeek match and replaced otherwise.
+class TokenCache {
+public:
+    TokenCache();
+
+    bool load( const std::string& path, uint64_t content, TokenStream& tokens );
+    void store( const std::string& path, uint64_t content, const TokenStream& tokens );
+
+private:
+    typedef struct {
+        char magic[8];
+        char build[64];
+        uint64_t content;
+        uint32_t num_tokens;
+        uint32_t strings_size;
+    } header_t;
+
+    void init_header( header_t& header, uint64_t content );
+
+    std::string get_cache_file( const std::string& path );
+
+    bool m_IsInitialized = false;
+    std::string m_Directory;
+};
+
+
+#endif // __tokencache_h__
@@ -0,0 +1,129 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "tokenizer.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+using namespace std;
+
+
+static inline bool is_space( char c )
+{
+    // \s in the classic locale: space, \t, \n, \v, \f and \r
+    return c == ' ' || ( c >= '\t' && c <= '\r' );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Tokenizer implementation
+//////////////////////////////////////////////////////////////////////////////
+
+size_t Tokenizer::tokenize( const char* text, size_t length )
+{
+    m_Text.assign( text, length );
+
+    // same as the separator \s+
+    split( [] ( const char* begin, const char* end, const char*& match_end ) -> const char* {
+        const char* match = find_if( begin, end, is_space );
+        match_end = find_if_not( match, end, is_space );
+        return match;
+    });
+
+    return m_Tokens.size();
+}
+
+size_t Tokenizer::tokenize( const char* text, size_t length, const char* separator, size_t separator_length )
+{
+    if( separator_length == 3 && memcmp( separator, "\\s+", 3 ) == 0 ) return tokenize( text, length );
+
+    m_Text.assign( text, length );
+
+    const char* special = "\\^$.|?*+()[]{}";
+    const bool is_plain = separator_length > 0 &&
+        none_of( separator, separator + separator_length, [special] ( char c ) { return strchr( special, c ) || !c; } );
+
+    if( is_plain ) {
+        split( [separator, separator_length] ( const char* begin, const char* end, const char*& match_end ) -> const char* {
+            const char* match = search( begin, end, separator, separator + separator_length );
+            match_end = match == end ? end : match + separator_length;
+            return match;
+        });
+    }
+    else {
+        const regex& pattern = get_regex( separator, separator_length );
+        const char* base = m_Text.data();
+
+        m_Tokens.clear();
+        for_each( cregex_token_iterator( base, base + m_Text.length(), pattern, -1 ),
+                  cregex_token_iterator(),
+                  [this, base] ( const csub_match& token )
+        {
+            m_Tokens.push_back( make_pair( token.first - base, token.length() ) );
+        });
+    }
+
+    return m_Tokens.size();
+}
+
+// find_separator returns the begin of the next separator or end and sets
+// match_end. Like std::cregex_token_iterator with submatch -1 the text
+// before each separator is a token, the remainder is a token if it is not
+// empty or no separator was found at all.
+template< typename F >
+void Tokenizer::split( F find_separator )
+{
+    const char* base = m_Text.data();
+    const char* end = base + m_Text.length();
+    const char* pos = base;
+
+    m_Tokens.clear();
+
+    for( ;; ) {
+        const char* match_end;
+        const char* match = find_separator( pos, end, match_end );
+        if( match == end ) break;
+
+        m_Tokens.push_back( make_pair( pos - base, match - pos ) );
+        pos = match_end;
+    }
+
+    if( pos != end || m_Tokens.empty() ) m_Tokens.push_back( make_pair( pos - base, end - pos ) );
+}
+
+const regex& Tokenizer::get_regex( const char* separator, size_t separator_length )
+{
+    string key( separator, separator_length );
+
+    auto iter = m_Regexes.find( key );
+    if( iter != m_Regexes.end() ) return iter->second;
+
+    regex pattern( key );
+    if( m_Regexes.size() >= MAX_CACHED_REGEXES ) m_Regexes.clear();
+
+    return m_Regexes.insert( make_pair( key, move( pattern ) ) ).first->second;
+}
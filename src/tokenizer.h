@@ -0,0 +1,96 @@
+/*  Copyright (c) 2020, Martin Hammel
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __tokenizer_h__
+#define __tokenizer_h__
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <regex>
+#include <utility>
+
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Tokenizer
+//////////////////////////////////////////////////////////////////////////////
+
+// splits a string for tokenize() and keeps the tokens for gettoken(). The
+// tokens are stored as offsets into a copy of the text. Whitespace and plain
+// character separators are split without a regex, other separators are
+// compiled once and kept in a cache.
+class Tokenizer {
+public:
+    Tokenizer() = default;
+
+    size_t tokenize( const char* text, size_t length );
+    size_t tokenize( const char* text, size_t length, const char* separator, size_t separator_length );
+
+    size_t get_num_tokens() const;
+
+    // returns an empty token if index is out of range
+    const char* get_token( size_t index, size_t& length ) const;
+
+private:
+    static const size_t MAX_CACHED_REGEXES = 64;
+
+    template< typename F > void split( F find_separator );
+
+    const std::regex& get_regex( const char* separator, size_t separator_length );
+
+    std::string m_Text;
+    std::vector< std::pair< size_t, size_t > > m_Tokens;
+
+    std::unordered_map< std::string, std::regex > m_Regexes;
+
+    Tokenizer( const Tokenizer& ) = delete;
+    Tokenizer& operator=( const Tokenizer& ) = delete;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+// class Tokenizer inline functions
+//////////////////////////////////////////////////////////////////////////////
+
+inline size_t Tokenizer::get_num_tokens() const
+{
+    return m_Tokens.size();
+}
+
+inline const char* Tokenizer::get_token( size_t index, size_t& length ) const
+{
+    if( index >= m_Tokens.size() ) {
+        length = 0;
+        return "";
+    }
+
+    length = m_Tokens[ index ].second;
+    return m_Text.data() + m_Tokens[ index ].first;
+}
+
+
+#endif // __tokenizer_h__
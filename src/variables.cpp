@@ -38,96 +38,106 @@ using namespace std;
 //////////////////////////////////////////////////////////////////////////////
 
 VarManager::VarManager()
+ : m_Arena( 4096 )
 {}
 
 VarManager::~VarManager()
 {
     for( auto value: m_Vars ) delete value.second;
-
-    if( m_Storage ) delete[] m_Storage;
-    while( !m_Stack.empty() ) {
-        delete[] m_Stack.top();
-        m_Stack.pop();
-    }
 }
 
-VarManager::var* VarManager::alloc_def( std::string name )
+VarManager::var* VarManager::alloc_def( symbol_t name )
 {
     auto iter = m_Vars.find( name );
 
     if( iter == m_Vars.end() ) {
-        size_t dot = name.find( '.' );
+        const string& str = SymbolTable::get_name( name );
+        size_t dot = str.find( '.' );
 
-        if( dot == string::npos ) {
-            VarManager::var* var = new VarManager::defvar();
-            iter = m_Vars.insert( make_pair( name, var ) ).first;
-        }
+        VarManager::var* var;
+
+        if( dot == string::npos ) var = new VarManager::defvar();
         else {
-            auto base = m_Vars.find( name.substr( 0, dot ) );
+            auto base = m_Vars.find( SymbolTable::intern( str.substr( 0, dot ) ) );
             if( base == m_Vars.end() ) return nullptr;
 
-            VarManager::var* var = new VarManager::structvar( base->second );
-            iter = m_Vars.insert( make_pair( name, var ) ).first;
+            var = new VarManager::structvar( base->second );
         }
+
+        insert( name, var );
+        return var;
     }
     else if( !iter->second->is_def() ) return nullptr;
 
     return iter->second;
 }
 
-VarManager::var* VarManager::alloc_global( std::string name )
+VarManager::var* VarManager::alloc_global( symbol_t name )
 {
     auto iter = m_Vars.find( name );
 
     if( iter == m_Vars.end() ) {
         VarManager::var* var = new VarManager::globalvar();
-        iter = m_Vars.insert( make_pair( name, var ) ).first;
+        insert( name, var );
+        return var;
     }
     else if( iter->second->is_def() ) return nullptr;
 
     return iter->second;
 }
 
-VarManager::var* VarManager::alloc_delegate( std::string name, VarManager::var* var )
+VarManager::var* VarManager::alloc_delegate( symbol_t name, VarManager::var* var )
 {
     if( m_Vars.find( name ) != m_Vars.end() ) return nullptr;
 
     VarManager::var* ref = new VarManager::delegatevar( var );
-    m_Vars[ name ] = ref;
+    insert( name, ref );
     return ref;
 }
 
-VarManager::var* VarManager::alloc_local( std::string name )
+VarManager::var* VarManager::alloc_local( symbol_t name )
 {
     auto iter = m_Vars.find( name );
 
     if( iter == m_Vars.end() ) {
         VarManager::var* var = new VarManager::localvar( m_Storage, m_StorageSize++ );
-        iter = m_Vars.insert( make_pair( name, var ) ).first;
+        insert( name, var );
+        m_Locals.push_back( var );
+        return var;
     }
     else if( iter->second->is_def() ) return nullptr;
 
     return iter->second;
 }
 
-void VarManager::get_autocompletion( std::set< std::string >& completions, std::string prefix )
+void VarManager::get_autocompletion( std::set< std::string >& completions, const std::string& prefix )
 {
-    for( auto iter = m_Vars.lower_bound( prefix ); iter != m_Vars.end(); iter++ ) {
-        if( iter->first.substr( 0, prefix.length() ) != prefix ) break;
-        completions.insert( iter->first );
+    for( auto value: m_Vars ) {
+        const string& name = SymbolTable::get_name( value.first );
+        if( name.compare( 0, prefix.length(), prefix ) == 0 ) completions.insert( name );
     }
 }
 
-std::set< std::string > VarManager::get_struct_members( std::string name )
+std::set< std::string > VarManager::get_struct_members( symbol_t name )
+{
+    auto iter = m_StructMembers.find( name );
+    if( iter == m_StructMembers.end() ) return set< string >();
+    else return iter->second;
+}
+
+void VarManager::get_locals( std::vector< VarManager::var* >& locals )
+{
+    locals.insert( locals.end(), m_Locals.begin(), m_Locals.end() );
+}
+
+void VarManager::insert( symbol_t name, VarManager::var* var )
 {
-    set< string > members;
+    m_Vars[ name ] = var;
 
-    for( auto iter = m_Vars.lower_bound( name + '.' ); iter != m_Vars.end(); iter++  ) {
-        if( iter->first.substr( 0, name.length() + 1 ) != name + '.' ) break;
-        members.insert( iter->first.substr( name.length() + 1, string::npos ) );
+    const string& str = SymbolTable::get_name( name );
+    for( size_t dot = str.find( '.' ); dot != string::npos; dot = str.find( '.', dot + 1 ) ) {
+        m_StructMembers[ SymbolTable::intern( str.substr( 0, dot ) ) ].insert( str.substr( dot + 1 ) );
     }
-
-    return members;
 }
 
 
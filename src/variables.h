@@ -26,9 +26,12 @@
 #ifndef __variables_h__
 #define __variables_h__
 
+#include "framearena.h"
+#include "symbols.h"
+
 #include <string>
-#include <stack>
-#include <map>
+#include <vector>
+#include <unordered_map>
 #include <set>
 
 #include <stdint.h>
@@ -45,16 +48,18 @@ public:
     VarManager();
     ~VarManager();
 
-    VarManager::var* alloc_def( std::string name );
-    VarManager::var* alloc_global( std::string name );
-    VarManager::var* alloc_delegate( std::string name, VarManager::var* var );
-    VarManager::var* alloc_local( std::string name );
+    VarManager::var* alloc_def( symbol_t name );
+    VarManager::var* alloc_global( symbol_t name );
+    VarManager::var* alloc_delegate( symbol_t name, VarManager::var* var );
+    VarManager::var* alloc_local( symbol_t name );
+
+    void get_autocompletion( std::set< std::string >& completions, const std::string& prefix );
 
-    void get_autocompletion( std::set< std::string >& completions, std::string prefix );
+    std::set< std::string > get_struct_members( symbol_t name );
 
-    std::set< std::string > get_struct_members( std::string name );
+    void get_locals( std::vector< VarManager::var* >& locals );
 
-    const VarManager::var* get( std::string name );
+    const VarManager::var* get( symbol_t name );
 
     void push();
     void pop();
@@ -66,11 +71,25 @@ private:
     class localvar;
     class delegatevar;
 
-    std::map< std::string, VarManager::var* > m_Vars;
+    void insert( symbol_t name, VarManager::var* var );
+
+    std::unordered_map< symbol_t, VarManager::var* > m_Vars;
+
+    // members of each struct in order for enumeration, nested members are
+    // listed with every prefix
+    std::unordered_map< symbol_t, std::set< std::string > > m_StructMembers;
+
+    std::vector< VarManager::var* > m_Locals;
+
+    typedef struct {
+        uint64_t* storage;
+        FrameArena< uint64_t >::mark_t mark;
+    } frame_t;
 
     uint64_t* m_Storage = nullptr;
     size_t m_StorageSize = 0;
-    std::stack< uint64_t* > m_Stack;
+    FrameArena< uint64_t > m_Arena;
+    std::vector< frame_t > m_Stack;
 };
 
 
@@ -192,7 +211,7 @@ private:
 // class VarManager inline functions
 //////////////////////////////////////////////////////////////////////////////
 
-inline const VarManager::var* VarManager::get( std::string name )
+inline const VarManager::var* VarManager::get( symbol_t name )
 {
     auto iter = m_Vars.find( name );
     if( iter == m_Vars.end() ) return nullptr;
@@ -202,17 +221,17 @@ inline const VarManager::var* VarManager::get( std::string name )
 inline void VarManager::push()
 {
     if( m_StorageSize > 0 ) {
-        m_Stack.push( m_Storage );
-        m_Storage = new uint64_t[ m_StorageSize ];
+        m_Stack.push_back( { m_Storage, m_Arena.get_mark() } );
+        m_Storage = m_Arena.alloc( m_StorageSize );
     }
 }
 
 inline void VarManager::pop()
 {
     if( !m_Stack.empty() ) {
-        delete[] m_Storage;
-        m_Storage = m_Stack.top();
-        m_Stack.pop();
+        m_Storage = m_Stack.back().storage;
+        m_Arena.release( m_Stack.back().mark );
+        m_Stack.pop_back();
     }
 }
 